@@ -8,6 +8,11 @@
 #include "expressions/Expression.hpp"
 #include "single_entities/terms/numbers/Rational.hpp"
 
+// Guard digits of the first evaluation, their growth and the limit of the following ones, see Calculator::calculate
+constexpr int64_t INITIAL_GUARD_PRECISION = 3;
+constexpr int64_t GUARD_PRECISION_MULTIPLIER = 4;
+constexpr int64_t MAX_GUARD_PRECISION = 64;
+
 static void insertFloatingPoint(std::string &strVal, int64_t precision);
 
 size_t cutZeros(std::string &strVal) {
@@ -57,12 +62,25 @@ void Calculator::toShortForm(std::string &strVal) const {
   }
 }
 
+/*
+  The expression is evaluated with a few guard digits first. If the bounds of the resulting ball are written
+  differently, the result cannot be rounded yet, so the guard digits are multiplied and the expression is evaluated
+  again. The results that never round, like exact ones on a boundary, take only a few evaluations this way.
+*/
 std::string Calculator::calculate(const std::string &strExpr) {
-  Expression expr(strExpr);
-  Rational val = solver.solve(expr);
-  std::string valStr = val.toString(solver.getPrecision());
-  toShortForm(valStr);
-  return valStr;
+  int64_t maxGuardPrecision = std::max(solver.getPrecision(), MAX_GUARD_PRECISION);
+
+  for (int64_t guardPrecision = INITIAL_GUARD_PRECISION;; guardPrecision *= GUARD_PRECISION_MULTIPLIER) {
+    solver.setGuardPrecision(guardPrecision);
+    Expression expr(strExpr);
+    Ball val = solver.solve(expr);
+
+    std::string valStr = toString(val.getMidpoint());
+    if (guardPrecision * GUARD_PRECISION_MULTIPLIER > maxGuardPrecision ||
+        (val.isBounded() && toString(val.getLower()) == valStr && toString(val.getUpper()) == valStr)) {
+      return valStr;
+    }
+  }
 }
 
 int64_t Calculator::getPrecision() const {
@@ -73,6 +91,12 @@ void Calculator::setPrecision(int64_t precision) {
   solver.setPrecision(precision);
 }
 
+std::string Calculator::toString(const Rational &val) const {
+  std::string valStr = val.toString(solver.getPrecision());
+  toShortForm(valStr);
+  return valStr;
+}
+
 static void insertFloatingPoint(std::string &strVal, int64_t precision) {
   strVal.insert(strVal.begin() + 1, '.');
   strVal += '0';
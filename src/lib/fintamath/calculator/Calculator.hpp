@@ -16,6 +16,7 @@ public:
 private:
   Solver solver;
 
+  std::string toString(const Rational &val) const;
   void toShortForm(std::string &strVal) const;
 };
 
@@ -10,14 +10,14 @@
 #include "single_entities/operators/Operator.hpp"
 #include "single_entities/terms/literals/Constant.hpp"
 
-static void elemReset(const std::shared_ptr<Expression::Elem> &elem, const Rational &val);
+static void elemReset(const std::shared_ptr<Expression::Elem> &elem, const Ball &val);
 
-Rational Solver::solve(Expression &expr) {
+Ball Solver::solve(Expression &expr) {
   if (expr.getRootModifiable()->right->right == nullptr && expr.getRootModifiable()->right->left == nullptr) {
-    return Rational(toRational(expr.getRootModifiable()->right).toString(precision));
+    return toBall(expr.getRootModifiable()->right);
   }
   solveRec(expr.getRootModifiable()->right);
-  return *std::dynamic_pointer_cast<Rational>(expr.getRootModifiable()->right->info);
+  return *std::dynamic_pointer_cast<Ball>(expr.getRootModifiable()->right->info);
 }
 
 int64_t Solver::getPrecision() const {
@@ -28,13 +28,26 @@ void Solver::setPrecision(int64_t precision_) {
   precision = precision_ <= 0 ? 1 : precision_;
 }
 
-Rational Solver::toRational(const std::shared_ptr<Expression::Elem> &elem) const {
+int64_t Solver::getGuardPrecision() const {
+  return guardPrecision;
+}
+
+void Solver::setGuardPrecision(int64_t guardPrecision_) {
+  guardPrecision = guardPrecision_ <= 0 ? 1 : guardPrecision_;
+}
+
+// Constants are accurate to a unit of their last digit
+Ball Solver::toBall(const std::shared_ptr<Expression::Elem> &elem) const {
   if (elem->info == nullptr) {
     throw std::invalid_argument("Solver invalid input");
   }
 
   if (elem->info->getTypeName() == "Constant") {
-    return Constant(elem->info->toString()).toRational(getNewPrecision());
+    return {Constant(elem->info->toString()).toRational(getNewPrecision()),
+            Rational(1, Integer::pow10(getNewPrecision()))};
+  }
+  if (elem->info->getTypeName() == "Ball") {
+    return *std::dynamic_pointer_cast<Ball>(elem->info);
   }
 
   try {
@@ -69,20 +82,19 @@ void Solver::solveRec(const std::shared_ptr<Expression::Elem> &elem) {
 
   if (elem->info->getTypeName() == "Operator") {
     Operator oper(elem->info->toString());
-    Rational val(oper.solve(toRational(elem->right), toRational(elem->left), getNewPrecision())
-                     .toString(getNewRoundPrecision()));
+    Ball val = oper.solve(toBall(elem->right), toBall(elem->left), getNewPrecision()).round(getNewRoundPrecision());
     elemReset(elem, val);
     return;
   }
 
   if (elem->info->getTypeName() == "Function") {
     Function func(elem->info->toString());
-    Rational val;
+    Ball val;
     if (types::isBinaryFunction(func.toString())) {
-      val = Rational(func.solve(toRational(elem->right), toRational(elem->left), getNewPrecision())
-                         .toString(getNewRoundPrecision()));
+      val = func.solve(toBall(elem->right), toBall(elem->left), getNewPrecision())
+                .round(getNewRoundPrecision());
     } else {
-      val = Rational(func.solve(toRational(elem->right), getNewPrecision()).toString(getNewRoundPrecision()));
+      val = func.solve(toBall(elem->right), getNewPrecision()).round(getNewRoundPrecision());
     }
     elemReset(elem, val);
     return;
@@ -90,16 +102,15 @@ void Solver::solveRec(const std::shared_ptr<Expression::Elem> &elem) {
 }
 
 int64_t Solver::getNewPrecision() const {
-  const int64_t PRECISION_INCREASER = 9;
-  return precision + PRECISION_INCREASER;
+  return precision + guardPrecision;
 }
 
 int64_t Solver::getNewRoundPrecision() const {
   return getNewPrecision() - 1;
 }
 
-static void elemReset(const std::shared_ptr<Expression::Elem> &elem, const Rational &val) {
-  elem->info = std::make_shared<Rational>(val);
+static void elemReset(const std::shared_ptr<Expression::Elem> &elem, const Ball &val) {
+  elem->info = std::make_shared<Ball>(val);
   elem->right.reset();
   elem->left.reset();
 }
@@ -2,6 +2,7 @@
 #define SOLVER_HPP
 
 #include "expressions/Expression.hpp"
+#include "single_entities/terms/numbers/Ball.hpp"
 #include "single_entities/terms/numbers/Rational.hpp"
 
 #include <cstdint>
@@ -16,18 +17,23 @@ struct Param {
 
 class Solver {
 public:
-  Rational solve(Expression &expr);
+  Ball solve(Expression &expr);
 
   int64_t getPrecision() const;
   void setPrecision(int64_t precision_);
 
+  int64_t getGuardPrecision() const;
+  void setGuardPrecision(int64_t guardPrecision_);
+
 private:
   const int64_t initialPrecision = 36;
+  const int64_t initialGuardPrecision = 9;
 
   std::vector<Param> params;
   int64_t precision = initialPrecision;
+  int64_t guardPrecision = initialGuardPrecision;
 
-  Rational toRational(const std::shared_ptr<Expression::Elem> &elem) const;
+  Ball toBall(const std::shared_ptr<Expression::Elem> &elem) const;
   void solveRec(const std::shared_ptr<Expression::Elem> &elem);
 
   int64_t getNewPrecision() const;
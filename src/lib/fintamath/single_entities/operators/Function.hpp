@@ -2,6 +2,7 @@
 #define FUNCTION_HPP
 
 #include "single_entities/ISingleEntity.hpp"
+#include "single_entities/terms/numbers/Ball.hpp"
 #include "single_entities/terms/numbers/Rational.hpp"
 
 #include <cstdint>
@@ -14,6 +15,9 @@ public:
   Rational solve(const Rational &rhs, int64_t precision) const;
   Rational solve(const Rational &lhs, const Rational &rhs, int64_t precision) const;
 
+  Ball solve(const Ball &rhs, int64_t precision) const;
+  Ball solve(const Ball &lhs, const Ball &rhs, int64_t precision) const;
+
   std::string getTypeName() const override;
   std::string toString() const override;
 
@@ -1,28 +1,86 @@
 #include "single_entities/operators/NamespaceFunctions.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <future>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "single_entities/terms/numbers/BigFloat.hpp"
 #include "single_entities/terms/numbers/Integer.hpp"
 
 // NOLINTNEXTLINE
 const Rational E_CONST("2.71828182845904523536028747135266249775724709369995957496696762772407663035354759");
 const int64_t E_INITIAL_PRECISION = 72;
+// Ranges of fewer terms are not split between threads
+const int64_t E_PARALLEL_TERMS_NUM = 1000;
 
 // NOLINTNEXTLINE
 const Rational PI_CONST("3.14159265358979323846264338327950288419716939937510582097494459230781640628620899");
 const int64_t PI_INITIAL_PRECISION = 72;
+// Ranges of fewer terms are not split between threads
+const int64_t PI_PARALLEL_TERMS_NUM = 100;
+
+// The fewest guard digits of the computations, see getNewPrecision
+const int64_t MIN_GUARD_PRECISION = 3;
+
+// ln is computed by the AGM above this precision
+const size_t LN_AGM_PRECISION = 150;
+
+// exp is computed by the bit-burst algorithm above this precision
+const size_t EXP_BIT_BURST_PRECISION = 1000;
+// sin and cos are computed by the bit-burst algorithm above this precision, two series are summed for each part
+const size_t SIN_COS_BIT_BURST_PRECISION = 20000;
+// The number of digits after the point in the first part of the bit-burst argument
+const size_t BIT_BURST_FIRST_DIGITS_NUM = 2;
+
+// The most precise value of a constant computed so far
+struct CachedConstant {
+  size_t precision;
+  Rational value;
+};
 
 static int64_t getNewPrecision(size_t precision);
-static Rational getInversedPrecisionVal(size_t precision);
+static BigFloat getInversedPrecisionVal(size_t precision);
+static BigFloat truncatedSqrt(BigFloat rhs, size_t precision);
 
-static Rational lnReduce(const Rational &rhs, Integer &multiplier, size_t precision);
+static BigFloat lnReduce(const Rational &rhs, Integer &multiplier, size_t precision);
 static Rational naturalPow(const Rational &lhs, const Integer &rhs);
 static Rational trigonometryReduce(const Rational &rhs, size_t multiplier, size_t precision);
+static Rational trigonometryQuotient(const Rational &rhs, bool isTangent, size_t precision);
+static int64_t getOrder(const Rational &rhs);
 static Integer factorialRec(const Integer &left, const Integer &right);
+static double log10Abs(const BigFloat &rhs);
+static BigFloat sumSeries(const BigFloat &rhs, size_t precision, int64_t (*numerator)(int64_t),
+                          int64_t (*denominator)(int64_t));
+static std::vector<std::pair<Integer, size_t>> splitBitBurst(const Rational &rhs, size_t precision);
+static BigFloat sumBitBurstSeries(const Integer &numerator, const Integer &denominator, int64_t (*multiplier)(int64_t),
+                                  size_t precision);
+static void seriesBinarySplitting(int64_t left, int64_t right, const Integer &numerator, const Integer &denominator,
+                                  int64_t (*multiplier)(int64_t), Integer &product, Integer &denominatorsProduct,
+                                  Integer &sum);
+static BigFloat bitBurstExp(const Rational &rhs, size_t precision);
+static void bitBurstSinCos(const Rational &rhs, size_t precision, BigFloat &sinVal, BigFloat &cosVal);
+static Rational getCachedConstant(std::shared_ptr<const CachedConstant> &cache, size_t precision,
+                                  Rational (*computeConstant)(size_t));
+static Rational computeLn(const Rational &rhs, size_t precision);
+static Rational agmLn(const Rational &rhs, size_t precision);
+static Rational computeE(size_t precision);
+static Rational computePi(size_t precision);
+static void eBinarySplitting(int64_t left, int64_t right, Integer &numerator, Integer &denominator, size_t threadsNum);
+static void piBinarySplitting(int64_t left, int64_t right, Integer &product, Integer &denominator, Integer &numerator,
+                              size_t threadsNum);
+
+static Rational getEvaluationError(size_t precision);
+static Ball toBall(const Rational &val, const Ball &rhs, const Rational &derivative, const Rational &error);
+static Ball getTangentBall(const Rational &val, const Ball &rhs, size_t precision);
+static Ball getArcsineBall(const Rational &val, const Ball &rhs, size_t precision);
 
 namespace functions {
 Rational abs(const Rational &rhs) {
@@ -40,49 +98,54 @@ Rational sqrt(const Rational &rhs, size_t precision) {
     return 0;
   }
 
-  std::string shift(precision, '0');
-  std::string shiftMult2(precision * 2, '0');
-  shift.insert(shift.begin(), '1');
-  shiftMult2.insert(shiftMult2.begin(), '1');
-
-  Rational val(sqrt((rhs * Integer(shiftMult2)).getInteger()), Integer(shift));
+  Rational val(sqrt((rhs * Integer::pow10(precision * 2)).getInteger()), Integer::pow10(precision));
   return val.round(precision);
 }
 
-// Using formula: log(a, b) = ln(b) / ln(a).
+/*
+  Using formula: log(a, b) = ln(b) / ln(a). The errors of the logarithms are multiplied by about (1 + |log(a, b)|) /
+  |ln(a)|, so they are computed again with more digits while ln(a) is too small or the result is too large for their
+  precision.
+*/
 Rational log(const Rational &lhs, const Rational &rhs, size_t precision) {
+  if (lhs == 1) {
+    throw std::domain_error("log out of range");
+  }
+
   try {
-    return (ln(rhs, precision) / ln(lhs, precision)).round(precision);
+    auto newPrecision = getNewPrecision(precision);
+    for (int64_t lnPrecision = newPrecision;;) {
+      Rational lhsLn = ln(lhs, lnPrecision);
+      Rational rhsLn = ln(rhs, lnPrecision);
+      if (lhsLn == 0) {
+        lnPrecision *= 2;
+        continue;
+      }
+
+      int64_t lhsOrder = getOrder(lhsLn);
+      int64_t minPrecision = newPrecision + std::max(getOrder(rhsLn) + 2 - lhsOrder, int64_t(0)) + 2 - lhsOrder;
+      if (lnPrecision >= minPrecision) {
+        return (rhsLn / lhsLn).round(precision);
+      }
+      lnPrecision = minPrecision;
+    }
   } catch (const std::domain_error &) {
     throw std::domain_error("log out of range");
   }
 }
 
-// Using Taylor series: ln(a) = sum_{k=0}^{inf} (2/(2k+1)) * ((a-1)/(a+1))^(2k+1)
+// ln(2) and ln(10) are cached
 Rational ln(const Rational &rhs, size_t precision) {
   if (rhs <= 0) {
     throw std::domain_error("ln out of range");
   }
-
-  Integer multiplier;
-  Rational rhsStep = lnReduce(rhs, multiplier, precision);
-  rhsStep = ((rhsStep - 1) / (rhsStep + 1)).round(getNewPrecision(precision));
-
-  Integer step = 1;
-  Rational precisionVal = getInversedPrecisionVal(getNewPrecision(precision));
-  Rational powRhs = rhsStep;
-  Rational rhsSqr = (rhsStep * rhsStep).round(getNewPrecision(precision));
-  Rational res = rhsStep;
-
-  do {
-    powRhs *= rhsSqr;
-    rhsStep = powRhs / (step * 2 + 1);
-    rhsStep = rhsStep.round(getNewPrecision(precision));
-    res += rhsStep;
-    step++;
-  } while (abs(rhsStep) > precisionVal);
-
-  return (res * multiplier * 2).round(precision);
+  if (rhs == 2) {
+    return getLn2(precision);
+  }
+  if (rhs == 10) {
+    return getLn10(precision);
+  }
+  return computeLn(rhs, precision);
 }
 
 // log2(a)
@@ -107,8 +170,9 @@ Rational lg(const Rational &rhs, size_t precision) {
 
 /*
   The power of the real a to the real degree n. n can be represented as
-  n_int + n_float, where |n_float| <= 1, then a^n = a^n_int * a^n_float. Using Taylor series for solving a^n_float:
-  a^n = 1 + sum_{k=1}^{inf} (n * ln(a))^k / k! where |n| <= 1.
+  n_int + n_float, where |n_float| <= 1, then a^n = a^n_int * a^n_float, where a^n_float = e^(n_float * ln(a)). The
+  errors of ln and exp are multiplied by a^n_int and a^n_float < max(a, 1), so their digits are added to the precision
+  of a^n_float.
 */
 Rational pow(const Rational &lhs, const Rational &rhs, size_t precision) {
   if (lhs == 0 && rhs == 0) {
@@ -131,30 +195,73 @@ Rational pow(const Rational &lhs, const Rational &rhs, size_t precision) {
     return lhsPowIntRhs;
   }
 
-  auto rhsMultLnRhs = Rational(rhs.getNumerator(), rhs.getDenominator()) * ln(rhsStep, precision);
-
-  Integer step = 1;
-  Rational precisionVal = getInversedPrecisionVal(getNewPrecision(precision));
-  Rational lhsPowFloatRhs = 1;
-
-  do {
-    rhsStep *= rhsMultLnRhs;
-    rhsStep /= step;
-    rhsStep = rhsStep.round(getNewPrecision(precision));
-    lhsPowFloatRhs += rhsStep;
-    step++;
-  } while (abs(rhsStep) > precisionVal);
+  auto floatPrecision =
+      (size_t)getNewPrecision(precision) + lhsPowIntRhs.getInteger().size() + rhsStep.getInteger().size();
+  Rational floatRhs(rhs.getNumerator(), rhs.getDenominator());
+  Rational lhsPowFloatRhs = exp(ln(rhsStep, floatPrecision) * floatRhs, floatPrecision);
 
   return (lhsPowFloatRhs * lhsPowIntRhs).round(precision);
 }
 
+/*
+  e^a = e^a_int * e^a_float, where e^a_int is the cached e raised to the power by squaring. Using the reduction
+  e^a_float = (e^b)^(2^k), where b = a_float/2^k, and Taylor series for the small b:
+  e^b = sum_{n=0}^{inf} b^n / n!.
+  Each squaring doubles the relative error, so the digits of 2^k and a_int are kept, as well as the integer digits of
+  the result. e^(-a) = 1 / e^a.
+*/
 Rational exp(const Rational &rhs, size_t precision) {
-  return pow(getE(precision), rhs, precision);
+  const double log10Of2 = 0.3010299956639812;
+  const double log10OfE = 0.4342944819032518;
+
+  if (rhs == 0) {
+    return 1;
+  }
+
+  Integer intRhs = rhs.getInteger();
+  Rational floatRhs(rhs.getNumerator(), rhs.getDenominator());
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  auto halvingsNum = (int64_t)std::sqrt(newPrecision);
+  auto resOrder = (size_t)(std::stod(intRhs.toString()) * log10OfE) + 1;
+  size_t expPrecision = newPrecision + resOrder + intRhs.size() + (size_t)((double)halvingsNum * log10Of2) + 1;
+
+  BigFloat res = 1;
+  if (floatRhs != 0 && precision > EXP_BIT_BURST_PRECISION) {
+    res = bitBurstExp(floatRhs, expPrecision);
+  } else if (floatRhs != 0) {
+    BigFloat rhsStep(floatRhs / naturalPow(2, halvingsNum), expPrecision, BigFloat::RoundingMode::HalfUp);
+    auto numerator = [](int64_t /*step*/) { return int64_t(1); };
+    auto denominator = [](int64_t step) { return step; };
+    res = sumSeries(rhsStep, expPrecision, numerator, denominator);
+
+    for (int64_t i = 0; i < halvingsNum; i++) {
+      res = (res * res).round(expPrecision);
+    }
+  }
+
+  BigFloat powE(getE(expPrecision), expPrecision, BigFloat::RoundingMode::HalfUp);
+  for (; intRhs != 0; intRhs /= 2) {
+    if (intRhs % 2 == 1) {
+      res = (res * powE).round(expPrecision);
+    }
+    if (intRhs > 1) {
+      powE = (powE * powE).round(expPrecision);
+    }
+  }
+
+  if (rhs < 0) {
+    res = BigFloat(1) / res;
+  }
+  return res.round(precision).toRational();
 }
 
-// Using reduction formulas and Taylor series: sin(a) = sum_{k=0}^{k=1} (-1)^k * x^(2k+1) / (2k+1)!
+/*
+  Using reduction formulas and Taylor series: sin(a) = sum_{k=0}^{inf} (-1)^k * a^(2k+1) / (2k+1)!. pi and cos are
+  computed with the guard digits, so the result is rounded once.
+*/
 Rational sin(const Rational &rhs, size_t precision) {
-  Rational pi = getPi(precision);
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  Rational pi = getPi(newPrecision);
   Rational piMult2 = pi * 2;
   Rational piDiv2 = pi / 2;
 
@@ -173,38 +280,37 @@ Rational sin(const Rational &rhs, size_t precision) {
     rhsStep -= pi;
   }
   if (rhsStep >= piDiv2) {
-    rhsStep = cos(rhsStep - piDiv2, precision);
+    rhsStep = cos(rhsStep - piDiv2, newPrecision);
     if (isNegative) {
       rhsStep = -rhsStep;
     }
     return rhsStep.round(precision);
   }
-  rhsStep = rhsStep.round(getNewPrecision(precision));
-
-  Integer step = 2;
-  Rational precisionVal = getInversedPrecisionVal(getNewPrecision(precision));
-  Rational rhsSqr = (rhsStep * rhsStep).round(getNewPrecision(precision));
-  Rational res = rhsStep;
-
-  do {
-    rhsStep *= -rhsSqr;
-    rhsStep /= (step * (step + 1));
-    rhsStep = rhsStep.round(getNewPrecision(precision));
-    res += rhsStep;
-    step += 2;
-  } while (abs(rhsStep) > precisionVal);
+  BigFloat res;
+  if (precision > SIN_COS_BIT_BURST_PRECISION) {
+    BigFloat cosVal;
+    bitBurstSinCos(rhsStep, newPrecision, res, cosVal);
+  } else {
+    BigFloat val(rhsStep, newPrecision, BigFloat::RoundingMode::HalfUp);
+    BigFloat rhsSqr = (val * val).round(newPrecision);
+    auto numerator = [](int64_t /*step*/) { return int64_t(-1); };
+    auto denominator = [](int64_t step) { return step * 2 * (step * 2 + 1); };
+    res = val * sumSeries(rhsSqr, newPrecision, numerator, denominator);
+  }
 
   if (isNegative) {
     res = -res;
   }
-  return res.round(precision);
+  return res.toRational().round(precision);
 }
 
 /*
-  Using Taylor series: cos(a) = sum_{k=0}^{k=1} (-1)^k * x^(2k) / (2k)
+  Using Taylor series: cos(a) = sum_{k=0}^{inf} (-1)^k * a^(2k) / (2k)!. pi and sin are computed with the guard digits,
+  so the result is rounded once.
 */
 Rational cos(const Rational &rhs, size_t precision) {
-  Rational pi = getPi(precision);
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  Rational pi = getPi(newPrecision);
   Rational piMult2 = pi * 2;
   Rational piDiv2 = pi / 2;
 
@@ -222,106 +328,35 @@ Rational cos(const Rational &rhs, size_t precision) {
     rhsStep = -(rhsStep - pi);
   }
   if (rhsStep >= piDiv2) {
-    return -sin(rhsStep - piDiv2, precision);
+    return (-sin(rhsStep - piDiv2, newPrecision)).round(precision);
+  }
+  BigFloat res;
+  if (precision > SIN_COS_BIT_BURST_PRECISION) {
+    BigFloat sinVal;
+    bitBurstSinCos(rhsStep, newPrecision, sinVal, res);
+  } else {
+    BigFloat val(rhsStep, newPrecision, BigFloat::RoundingMode::HalfUp);
+    BigFloat rhsSqr = (val * val).round(newPrecision);
+    auto numerator = [](int64_t /*step*/) { return int64_t(-1); };
+    auto denominator = [](int64_t step) { return (step * 2 - 1) * step * 2; };
+    res = sumSeries(rhsSqr, newPrecision, numerator, denominator);
   }
-  rhsStep = rhsStep.round(getNewPrecision(precision));
-
-  Integer step = 2;
-  Rational precisionVal = getInversedPrecisionVal(getNewPrecision(precision));
-  Rational rhsSqr = (rhsStep * rhsStep).round(getNewPrecision(precision));
-  Rational res = 1;
-  rhsStep = 1;
-
-  do {
-    rhsStep *= -rhsSqr;
-    rhsStep /= step * (step - 1);
-    rhsStep = rhsStep.round(getNewPrecision(precision));
-    res += rhsStep;
-    step += 2;
-  } while (abs(rhsStep) > precisionVal);
 
   if (isNegative) {
     res = -res;
   }
 
-  return res.round(precision);
+  return res.toRational().round(precision);
 }
 
 // tan(a) = sin(a) / cos(a)
 Rational tan(const Rational &rhs, size_t precision) {
-  Rational pi = getPi(precision);
-  Rational piDiv2 = pi / 2;
-
-  Rational val = rhs;
-  bool isNegative = false;
-
-  if (val < 0) {
-    isNegative = true;
-    val = -val;
-  }
-  if (val >= pi) {
-    val = trigonometryReduce(val, 2, precision);
-  }
-  if (val >= piDiv2) {
-    try {
-      val = -cot(val - piDiv2, precision);
-    } catch (const std::domain_error &) {
-      throw std::domain_error("tan out of range");
-    }
-
-    if (isNegative) {
-      val = -val;
-    }
-    return val;
-  }
-
-  val = cos(val, precision);
-
-  Rational res = sqrt(1 - val * val, precision) / val;
-  if (isNegative) {
-    res = -res;
-  }
-  return res.round(precision);
+  return trigonometryQuotient(rhs, true, precision);
 }
 
 // cot(a) = cos(a) / sin(a)
 Rational cot(const Rational &rhs, size_t precision) {
-  Rational pi = getPi(precision);
-  Rational piDiv2 = pi / 2;
-
-  Rational val = rhs;
-  bool isNegative = false;
-
-  if (val < 0) {
-    isNegative = true;
-    val = -val;
-  }
-  if (val >= pi) {
-    val = trigonometryReduce(val, 2, precision);
-  }
-  if (val >= piDiv2) {
-    try {
-      val = -tan(val - piDiv2, precision);
-    } catch (const std::domain_error &) {
-      throw std::domain_error("cot out of range");
-    }
-
-    if (isNegative) {
-      val = -val;
-    }
-    return val;
-  }
-
-  Rational sinVal = sin(val, precision);
-  if (sinVal.round(precision - 1) == 0) {
-    throw std::domain_error("cot out of range");
-  }
-
-  Rational res = sqrt(1 - sinVal * sinVal, precision) / sinVal;
-  if (isNegative) {
-    res = -res;
-  }
-  return res.round(precision);
+  return trigonometryQuotient(rhs, false, precision);
 }
 
 // Вычисление asin(x) = pi/2 - acos(x)
@@ -329,54 +364,47 @@ Rational asin(const Rational &rhs, size_t precision) {
   if (abs(rhs) > 1) {
     throw std::domain_error("asin out of range");
   }
-  Rational res = (getPi(precision) / 2 - acos(rhs, precision));
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  Rational res = (getPi(newPrecision) / 2 - acos(rhs, newPrecision));
   return res.round(precision);
 }
 
 /*
   If |a| <= 1/5, using Taylor series: acos(a) = pi/2 - sum_{k=0}^{inf}((2k)! * a^(2k+1) / (4^k * (k!)^2 * (2k+1)).
-  Else using the formula: acos(a) = pi/2 - sum_{k=0}^{inf}((2k)! * a^(2k+1) / (4^k * (k!)^2 * (2k+1)).
+  Else using the formula: acos(a) = 2 * atan(sqrt((1 - a) / (1 + a))). a is not rounded there, as acos'(a) is unbounded
+  near 1.
 */
 Rational acos(const Rational &rhs, size_t precision) {
   if (abs(rhs) > 1) {
     throw std::domain_error("acos out of range");
   }
 
-  Rational rhsStep = rhs.round(getNewPrecision(precision));
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  Rational rhsStep = rhs;
   bool isNegative = false;
   if (rhsStep < 0) {
     isNegative = true;
     rhsStep = -rhsStep;
   }
 
-  Rational pi = getPi(precision);
+  Rational pi = getPi(newPrecision);
   const Rational maxRedusedVal(1, 5);
 
   if (rhsStep <= maxRedusedVal) {
-    Integer step = 1;
-    Rational precisionVal = getInversedPrecisionVal(getNewPrecision(precision));
-    Rational val = rhsStep;
-    Rational rhsSqr = (rhsStep * rhsStep).round(getNewPrecision(precision));
-    Rational res = rhsStep;
-
-    do {
-      val *= (step * 2 - 1) * rhsSqr;
-      val /= step * 2;
-      val = val.round(getNewPrecision(precision));
-      rhsStep = val / (step * 2 + 1);
-      rhsStep = rhsStep.round(getNewPrecision(precision));
-      res += rhsStep;
-      step++;
-    } while (abs(rhsStep) > precisionVal);
-
-    res = pi / 2 - res;
+    BigFloat val(rhsStep, newPrecision, BigFloat::RoundingMode::HalfUp);
+    BigFloat rhsSqr = (val * val).round(newPrecision);
+    auto numerator = [](int64_t step) { return (step * 2 - 1) * (step * 2 - 1); };
+    auto denominator = [](int64_t step) { return step * 2 * (step * 2 + 1); };
+    BigFloat res = val * sumSeries(rhsSqr, newPrecision, numerator, denominator);
+
+    Rational resVal = pi / 2 - res.toRational();
     if (isNegative) {
-      res = pi - res;
+      resVal = pi - resVal;
     }
-    return res.round(precision);
+    return resVal.round(precision);
   }
 
-  Rational res = atan(sqrt((1 - rhsStep) / (1 + rhsStep), precision), precision) * 2;
+  Rational res = atan(sqrt((1 - rhsStep) / (1 + rhsStep), newPrecision), newPrecision) * 2;
   if (isNegative) {
     res = pi - res;
   }
@@ -388,7 +416,8 @@ Rational acos(const Rational &rhs, size_t precision) {
   Else using the formula: atan(a) = acos(1 / sqrt(1 + x^2)).
 */
 Rational atan(const Rational &rhs, size_t precision) {
-  Rational rhsStep = rhs.round(getNewPrecision(precision));
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  Rational rhsStep = rhs.round(newPrecision);
   bool isNegative = false;
   if (rhsStep < 0) {
     isNegative = true;
@@ -398,28 +427,19 @@ Rational atan(const Rational &rhs, size_t precision) {
   const Rational maxNumberToReduce(1, 5);
 
   if (rhsStep <= maxNumberToReduce) {
-    Integer step = 2;
-    Rational precisionVal = getInversedPrecisionVal(getNewPrecision(precision));
-    Rational val = rhsStep;
-    Rational rhsSqr = (rhsStep * rhsStep).round(getNewPrecision(precision));
-    Rational res = rhsStep;
-
-    do {
-      val *= -rhsSqr;
-      val = val.round(getNewPrecision(precision));
-      rhsStep = val / (step * 2 - 1);
-      rhsStep = rhsStep.round(getNewPrecision(precision));
-      res += rhsStep;
-      step++;
-    } while (abs(rhsStep) > precisionVal);
+    BigFloat val(rhsStep, newPrecision, BigFloat::RoundingMode::HalfUp);
+    BigFloat rhsSqr = (val * val).round(newPrecision);
+    auto numerator = [](int64_t step) { return 1 - step * 2; };
+    auto denominator = [](int64_t step) { return step * 2 + 1; };
+    BigFloat res = val * sumSeries(rhsSqr, newPrecision, numerator, denominator);
 
     if (isNegative) {
       res = -res;
     }
-    return res.round(precision);
+    return res.toRational().round(precision);
   }
 
-  Rational res = acos(1 / sqrt(1 + rhsStep * rhsStep, precision), precision);
+  Rational res = acos(1 / sqrt(1 + rhsStep * rhsStep, newPrecision), newPrecision);
   if (isNegative) {
     res = -res;
   }
@@ -428,11 +448,12 @@ Rational atan(const Rational &rhs, size_t precision) {
 
 // acot(x) = pi/2 - atan(x)
 Rational acot(const Rational &rhs, size_t precision) {
-  Rational res = getPi(precision) / 2;
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  Rational res = getPi(newPrecision) / 2;
   if (rhs < 0) {
     res = -res;
   }
-  return (res - atan(rhs, precision)).round(precision);
+  return (res - atan(rhs, newPrecision)).round(precision);
 }
 
 Rational factorial(const Rational &rhs) {
@@ -456,24 +477,30 @@ Rational doubleFactorial(const Rational &rhs) {
   return res;
 }
 
-// Using Taylor series: e = sum_{k=0}^{inf} 1/n!
 Rational getE(size_t precision) {
   if (precision <= E_INITIAL_PRECISION) {
     return E_CONST;
   }
+  static std::shared_ptr<const CachedConstant> cache;
+  return getCachedConstant(cache, precision, computeE);
+}
 
-  Integer step = 1;
-  Rational precisionVal = getInversedPrecisionVal(getNewPrecision(precision));
-  Rational stepVal = 1;
-  Rational res = 1;
+Rational getPi(size_t precision) {
+  if (precision <= PI_INITIAL_PRECISION) {
+    return PI_CONST;
+  }
+  static std::shared_ptr<const CachedConstant> cache;
+  return getCachedConstant(cache, precision, computePi);
+}
 
-  do {
-    stepVal /= step;
-    res += stepVal;
-    step++;
-  } while (abs(stepVal) > precisionVal);
+Rational getLn2(size_t precision) {
+  static std::shared_ptr<const CachedConstant> cache;
+  return getCachedConstant(cache, precision, [](size_t newPrecision) { return computeLn(2, newPrecision); });
+}
 
-  return res.round(precision);
+Rational getLn10(size_t precision) {
+  static std::shared_ptr<const CachedConstant> cache;
+  return getCachedConstant(cache, precision, [](size_t newPrecision) { return computeLn(10, newPrecision); });
 }
 
 /*
@@ -491,57 +518,230 @@ Rational getE(size_t precision) {
 
   pi = (a + b)^2 / (4 * t)
 */
-Rational getPi(size_t precision) {
+Rational getPiAgm(size_t precision) {
   if (precision <= PI_INITIAL_PRECISION) {
     return PI_CONST;
   }
 
-  Integer step = lb((int64_t)precision, precision).getInteger() + 1;
+  // The steps are computed with guard digits, the result is rounded once
+  auto newPrecision = (size_t)getNewPrecision(precision);
+
+  // The number of correct digits doubles with each step
+  Integer step = (int64_t)std::log2((double)newPrecision) + 1;
   Integer p = 1;
-  Rational a = 1;
-  Rational b = 1 / functions::sqrt(2, precision);
-  auto t = Rational(1, 4);
+  const BigFloat half(5, -1);
+  BigFloat a = 1;
+  BigFloat b(1 / functions::sqrt(2, newPrecision), newPrecision, BigFloat::RoundingMode::HalfUp);
+  BigFloat t(25, -2);
 
   for (Integer i = 0; i < step; ++i) {
-    Rational prevA = a;
-    Rational prevB = b;
-    Rational prevT = t;
-    a = (prevA + prevB) / 2;
-    b = sqrt(prevA * prevB, precision);
-    Rational diff = (prevA - a);
-    t = (prevT - p * diff * diff).round(precision);
+    BigFloat prevA = a;
+    BigFloat prevB = b;
+    BigFloat prevT = t;
+    a = (prevA + prevB) * half;
+    b = truncatedSqrt(prevA * prevB, newPrecision);
+    BigFloat diff = (prevA - a);
+    t = (prevT - diff * diff * p).round(newPrecision);
     p *= 2;
   }
 
-  return ((a + b) * (a + b) / (4 * t)).round(precision);
+  return (((a + b) * (a + b)).toRational() / (t * 4).toRational()).round(precision);
+}
+
+Ball abs(const Ball &rhs) {
+  return toBall(abs(rhs.getMidpoint()), rhs, 1, 0);
+}
+
+// |sqrt'| <= 1/(2 sqrt(a - r)) <= 1/sqrt(a) if r <= 3a/4
+Ball sqrt(const Ball &rhs, size_t precision) {
+  Rational val = sqrt(rhs.getMidpoint(), precision);
+  Rational error = getEvaluationError(precision);
+  if (!rhs.isBounded() || rhs.getRadius() == 0) {
+    return toBall(val, rhs, 0, error);
+  }
+
+  const int64_t maxRadiusDivider = 4;
+  const int64_t maxRadiusMultiplier = 3;
+  if (rhs.getRadius() * maxRadiusDivider > rhs.getMidpoint() * maxRadiusMultiplier) {
+    return Ball::getUnbounded(val);
+  }
+  return toBall(val, rhs, (val + error) / rhs.getMidpoint(), error);
+}
+
+/*
+  |d(a^n)/da| = |n| * |a^n| / |a|, |d(a^n)/dn| = |ln(a)| * |a^n|. On the ball |a^n| grows at most by
+  exp((|n| + 1) * rA / (|a| - rA) + |ln(a)| * rN), where |ln(a)| <= max(a, 1/a) and exp(x) <= 1 + 2x if x <= 1.
+  Natural powers are exact, other ones are calculated with ln(a).
+*/
+Ball pow(const Ball &lhs, const Ball &rhs, size_t precision) {
+  Rational val = pow(lhs.getMidpoint(), rhs.getMidpoint(), precision);
+  if (!lhs.isBounded() || !rhs.isBounded()) {
+    return Ball::getUnbounded(val);
+  }
+
+  Rational lhsAbs = abs(lhs.getMidpoint());
+  Rational lhsRadius = lhs.getRadius();
+  Rational rhsRadius = rhs.getRadius();
+  Rational rhsAbs = abs(rhs.getMidpoint()) + rhsRadius;
+
+  Rational error = rhs.getMidpoint().getNumerator() != 0 ? getEvaluationError(precision) : 0;
+  if (lhsRadius == 0 && rhsRadius == 0) {
+    return {val, error};
+  }
+  if (lhsAbs <= lhsRadius) {
+    return lhsRadius == 0 && lhsAbs == 0 && rhs.getMidpoint() > rhsRadius ? Ball(val, error) : Ball::getUnbounded(val);
+  }
+
+  Rational lhsRatio = lhsRadius / (lhsAbs - lhsRadius);
+  Rational lnMax = 0;
+  if (rhsRadius != 0) {
+    if (lhs.getMidpoint() < 0) {
+      return Ball::getUnbounded(val);
+    }
+    lnMax = std::max(lhsAbs + lhsRadius, 1 / (lhsAbs - lhsRadius));
+  }
+
+  Rational growthPow = (rhsAbs + 1) * lhsRatio + lnMax * rhsRadius;
+  if (growthPow > 1) {
+    return Ball::getUnbounded(val);
+  }
+  Rational maxVal = (abs(val) + error) * (1 + growthPow * 2);
+
+  return {val, rhsAbs * maxVal * lhsRadius / (lhsAbs - lhsRadius) + lnMax * maxVal * rhsRadius + error};
+}
+
+// |exp'| = exp(a + r) <= exp(a) * (1 + 2r) if r <= 1
+Ball exp(const Ball &rhs, size_t precision) {
+  Rational val = exp(rhs.getMidpoint(), precision);
+  Rational error = getEvaluationError(precision);
+  if (!rhs.isBounded() || rhs.getRadius() > 1) {
+    return Ball::getUnbounded(val);
+  }
+  return toBall(val, rhs, (abs(val) + error) * (rhs.getRadius() * 2 + 1), error);
+}
+
+Ball log(const Ball &lhs, const Ball &rhs, size_t precision) {
+  try {
+    return ln(rhs, precision) / ln(lhs, precision);
+  } catch (const std::domain_error &) {
+    throw std::domain_error("log out of range");
+  }
+}
+
+// |ln'| <= 1/(a - r)
+Ball ln(const Ball &rhs, size_t precision) {
+  Rational val = ln(rhs.getMidpoint(), precision);
+  Rational error = getEvaluationError(precision);
+  if (!rhs.isBounded() || rhs.getRadius() == 0) {
+    return toBall(val, rhs, 0, error);
+  }
+  if (rhs.getMidpoint() <= rhs.getRadius()) {
+    return Ball::getUnbounded(val);
+  }
+  return toBall(val, rhs, 1 / (rhs.getMidpoint() - rhs.getRadius()), error);
+}
+
+Ball lb(const Ball &rhs, size_t precision) {
+  const int64_t logBase = 2;
+  try {
+    return log(Rational(logBase), rhs, precision);
+  } catch (const std::domain_error &) {
+    throw std::domain_error("lb out of range");
+  }
+}
+
+Ball lg(const Ball &rhs, size_t precision) {
+  const int64_t logBase = 10;
+  try {
+    return log(Rational(logBase), rhs, precision);
+  } catch (const std::domain_error &) {
+    throw std::domain_error("lg out of range");
+  }
+}
+
+Ball sin(const Ball &rhs, size_t precision) {
+  return toBall(sin(rhs.getMidpoint(), precision), rhs, 1, getEvaluationError(precision));
+}
+
+Ball cos(const Ball &rhs, size_t precision) {
+  return toBall(cos(rhs.getMidpoint(), precision), rhs, 1, getEvaluationError(precision));
+}
+
+Ball tan(const Ball &rhs, size_t precision) {
+  return getTangentBall(tan(rhs.getMidpoint(), precision), rhs, precision);
+}
+
+Ball cot(const Ball &rhs, size_t precision) {
+  return getTangentBall(cot(rhs.getMidpoint(), precision), rhs, precision);
+}
+
+Ball asin(const Ball &rhs, size_t precision) {
+  return getArcsineBall(asin(rhs.getMidpoint(), precision), rhs, precision);
+}
+
+Ball acos(const Ball &rhs, size_t precision) {
+  return getArcsineBall(acos(rhs.getMidpoint(), precision), rhs, precision);
+}
+
+// |atan'| = |acot'| <= 1
+Ball atan(const Ball &rhs, size_t precision) {
+  return toBall(atan(rhs.getMidpoint(), precision), rhs, 1, getEvaluationError(precision));
+}
+
+Ball acot(const Ball &rhs, size_t precision) {
+  return toBall(acot(rhs.getMidpoint(), precision), rhs, 1, getEvaluationError(precision));
+}
+
+Ball factorial(const Ball &rhs) {
+  Rational val = factorial(rhs.getMidpoint());
+  if (!rhs.isBounded() || rhs.getRadius() != 0) {
+    return Ball::getUnbounded(val);
+  }
+  return val;
+}
+
+Ball doubleFactorial(const Ball &rhs) {
+  Rational val = doubleFactorial(rhs.getMidpoint());
+  if (!rhs.isBounded() || rhs.getRadius() != 0) {
+    return Ball::getUnbounded(val);
+  }
+  return val;
 }
 } // namespace functions
 
 static int64_t getNewPrecision(size_t precision) {
-  return (int64_t)precision + (int64_t)sqrt((double)precision);
+  return (int64_t)precision + std::max((int64_t)sqrt((double)precision), MIN_GUARD_PRECISION);
 }
 
-static Rational getInversedPrecisionVal(size_t precision) {
-  std::string precStr(precision + 1, '0');
-  precStr.front() = '1';
-  return (Rational(1, Integer(precStr)));
+static BigFloat getInversedPrecisionVal(size_t precision) {
+  return {1, -(int64_t)precision};
+}
+
+// Truncated like sqrt(Rational, size_t)
+static BigFloat truncatedSqrt(BigFloat rhs, size_t precision) {
+  rhs.setPrecision(precision);
+  rhs.setRoundingMode(BigFloat::RoundingMode::Down);
+  BigFloat res = sqrt(rhs);
+  res.setRoundingMode(BigFloat::RoundingMode::HalfUp);
+  return res;
 }
 
 /*
   Decrease the value of a under the logarithm so that a -> 1. Using the formula log(a^n) = n*log, by taking a multiple
-  square root, the number is reduced to to the desired form.
+  square root, the number is reduced to to the desired form. For 1 <= a <= 10 each root adds an error less than
+  10^(-precision) to ln of the result, which halves the errors of the previous ones.
 */
-static Rational lnReduce(const Rational &rhs, Integer &multiplier, size_t precision) {
-  const Rational maxRedusedVal("0.01");
-  Rational res = rhs.round(getNewPrecision(precision));
+static BigFloat lnReduce(const Rational &rhs, Integer &multiplier, size_t precision) {
+  const BigFloat maxRedusedVal(1, -2);
+  BigFloat res(rhs, precision, BigFloat::RoundingMode::HalfUp);
   multiplier = 1;
 
-  while (functions::abs(res - 1) > maxRedusedVal) {
+  while (abs(res - 1) > maxRedusedVal) {
     multiplier *= 2;
-    res = functions::sqrt(res, precision);
+    res = truncatedSqrt(res, precision);
   }
 
-  return res.round(precision);
+  return res;
 }
 
 /*
@@ -578,6 +778,46 @@ static Rational trigonometryReduce(const Rational &rhs, size_t multiplier, size_
   return res;
 }
 
+/*
+  tan(a) = sin(a) / cos(a) or cot(a) = cos(a) / sin(a), sin and cos reduce a themselves. The errors of sin and cos are
+  multiplied by about 1/d^2, where d is the divisor, so 2z + 1 digits are added if d has z zeros after the point. The
+  divisor rounded to zero with one digit less than the precision, but at least to an integer, is out of range.
+*/
+static Rational trigonometryQuotient(const Rational &rhs, bool isTangent, size_t precision) {
+  const size_t extraDigitsNum = 3;
+
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  Rational (*divisorFunction)(const Rational &, size_t) = functions::sin;
+  Rational (*dividendFunction)(const Rational &, size_t) = functions::cos;
+  if (isTangent) {
+    std::swap(divisorFunction, dividendFunction);
+  }
+
+  size_t quotientPrecision = newPrecision + extraDigitsNum;
+  Rational divisor = divisorFunction(rhs, quotientPrecision);
+  if (divisor.round(precision == 0 ? 0 : precision - 1) == 0) {
+    throw std::domain_error(isTangent ? "tan out of range" : "cot out of range");
+  }
+
+  auto minPrecision = newPrecision + (size_t)std::max(1 - getOrder(divisor), int64_t(0)) * 2 + 1;
+  if (minPrecision > quotientPrecision) {
+    quotientPrecision = minPrecision;
+    divisor = divisorFunction(rhs, quotientPrecision);
+  }
+  return (dividendFunction(rhs, quotientPrecision) / divisor).round(precision);
+}
+
+/*
+  |a| is at least 10^(order - 1) and less than 10^(order + 1), where order is the number of the integer digits if
+  |a| >= 1, and the number of the digits of the numerator minus the number of the digits of the denominator otherwise.
+*/
+static int64_t getOrder(const Rational &rhs) {
+  if (functions::abs(rhs) >= 1) {
+    return (int64_t)rhs.getInteger().size();
+  }
+  return (int64_t)rhs.getNumerator().size() - (int64_t)rhs.getDenominator().size();
+}
+
 // Calculation of the factorial through multipliers decomposition in a tree
 static Integer factorialRec(const Integer &left, const Integer &right) {
   if (left == right) {
@@ -589,3 +829,473 @@ static Integer factorialRec(const Integer &left, const Integer &right) {
   Integer mid = (left + right) / 2;
   return factorialRec(left, mid) * factorialRec(mid + 1, right);
 }
+
+// lg(|a|) by the leading digits of the mantissa
+static double log10Abs(const BigFloat &rhs) {
+  const size_t doubleDigitsNum = 17;
+
+  std::string mantissaStr = abs(rhs).getMantissa().toString();
+  size_t leadingDigitsNum = std::min(mantissaStr.size(), doubleDigitsNum);
+  double leadingDigits = std::stod(mantissaStr.substr(0, leadingDigitsNum));
+  return std::log10(leadingDigits) + (double)(mantissaStr.size() - leadingDigitsNum) + (double)rhs.getExponent();
+}
+
+/*
+  Paterson-Stockmeyer rectangular splitting for sum_{k=0}^{n} c_k * a^k, where c_0 = 1,
+  c_k = c_{k-1} * numerator(k) / denominator(k) and the terms after n are less than 10^(-precision). The terms are split
+  into blocks of m = sqrt(n) terms from the last one: S_j = sum_{i=0}^{m-1} (c_{jm+i} / c_{jm}) * a^i +
+  (c_{(j+1)m} / c_{jm}) * a^m * S_{j+1}, the sum is S_0. The coefficients of a block are integers over the product of
+  its denominators, so a^2..a^m and the multiplication by a^m per block are the only full multiplications, the others
+  are by integers of a few limbs. If |a| <= 1/2 and |numerator(k)| <= |denominator(k)|, the rounded a^i are off by less
+  than 10^(-precision), a^m halves the error of S_{j+1}, and the error of the sum is less than
+  (2 * sqrt(n) + 9) * 10^(-precision). For sin and cos a < 2.5, but c_{k+i} / c_k <= 1/(2i)!, and the error is less
+  than 3 * 10^(-precision).
+*/
+static BigFloat sumSeries(const BigFloat &rhs, size_t precision, int64_t (*numerator)(int64_t),
+                          int64_t (*denominator)(int64_t)) {
+  BigFloat one = 1;
+  one.setPrecision(precision);
+  if (rhs == 0) {
+    return one;
+  }
+
+  double rhsLog = log10Abs(rhs);
+  int64_t termsNum = 1;
+  for (double termLog = 0; termLog >= -(double)precision; termsNum++) {
+    termLog += rhsLog + std::log10(std::abs((double)numerator(termsNum) / (double)denominator(termsNum)));
+  }
+
+  auto blockSize = std::max((int64_t)std::sqrt((double)termsNum), int64_t(1));
+  std::vector<BigFloat> powers = {one, rhs};
+  for (int64_t i = 2; i <= blockSize; i++) {
+    powers.push_back((powers.back() * rhs).round(precision));
+  }
+
+  BigFloat res;
+  for (int64_t first = (termsNum - 1) / blockSize * blockSize; first >= 0; first -= blockSize) {
+    int64_t size = std::min(blockSize, termsNum - first);
+
+    // denominators[i] = prod_{t=i+1}^{size-1} denominator(first + t)
+    std::vector<Integer> denominators(size, 1);
+    for (int64_t i = size - 2; i >= 0; i--) {
+      denominators[i] = denominators[i + 1] * denominator(first + i + 1);
+    }
+
+    BigFloat blockSum = one * denominators[0];
+    Integer numeratorsProduct = 1;
+    for (int64_t i = 1; i < size; i++) {
+      numeratorsProduct *= numerator(first + i);
+      blockSum += powers[i] * (numeratorsProduct * denominators[i]);
+    }
+
+    if (first + size == termsNum) {
+      res = blockSum / denominators[0];
+      continue;
+    }
+    int64_t nextDenominator = denominator(first + size);
+    res = (powers[size] * res).round(precision) * (numeratorsProduct * numerator(first + size));
+    res = (blockSum * nextDenominator + res) / (denominators[0] * nextDenominator);
+  }
+
+  return res;
+}
+
+/*
+  The bit-burst splitting a = a_0 + a_1 + ... + a_n, where a_0 has the integer part and the first d digits after the
+  point and a_j has the digits from d*2^(j-1) to d*2^j, so a_j = p_j / 10^(d*2^j) and p_j has d*2^(j-1) digits. Then
+  the series for a_j converges by d*2^(j-1) digits a term, so the sizes of the numbers in binary splitting are about the
+  precision for each part. The pairs (p_j, d*2^j) are returned, the zero parts and the digits after the precision are
+  dropped.
+*/
+static std::vector<std::pair<Integer, size_t>> splitBitBurst(const Rational &rhs, size_t precision) {
+  std::string digits = (rhs * Integer::pow10(precision)).getInteger().toString();
+  if (digits.size() < precision) {
+    digits.insert(0, precision - digits.size(), '0');
+  }
+  size_t intDigitsNum = digits.size() - precision;
+
+  std::vector<std::pair<Integer, size_t>> res;
+  size_t first = 0;
+  for (size_t last = std::min(BIT_BURST_FIRST_DIGITS_NUM, precision); first < precision;
+       first = last, last = std::min(last * 2, precision)) {
+    size_t begin = first == 0 ? 0 : intDigitsNum + first;
+    Integer part(digits.substr(begin, intDigitsNum + last - begin));
+    if (part != 0) {
+      res.emplace_back(part, last);
+    }
+  }
+
+  return res;
+}
+
+/*
+  1 + sum_{k=1}^{n} prod_{i=1}^{k} numerator / (denominator * multiplier(i)), where the terms after n are less than
+  10^(-precision).
+*/
+static BigFloat sumBitBurstSeries(const Integer &numerator, const Integer &denominator, int64_t (*multiplier)(int64_t),
+                                  size_t precision) {
+  double ratioLog = log10Abs(numerator) - log10Abs(denominator);
+  int64_t termsNum = 0;
+  for (double termLog = 0; termLog >= -(double)precision;) {
+    termsNum++;
+    termLog += ratioLog - std::log10((double)multiplier(termsNum));
+  }
+
+  Integer product;
+  Integer denominatorsProduct;
+  Integer sum;
+  seriesBinarySplitting(1, termsNum + 1, numerator, denominator, multiplier, product, denominatorsProduct, sum);
+
+  BigFloat res = sum;
+  res.setPrecision(precision);
+  res /= denominatorsProduct;
+  return res + 1;
+}
+
+/*
+  Binary splitting of sum_{k=left}^{right-1} prod_{i=left}^{k} numerator / (denominator * multiplier(i)) = T / Q, where
+  P and Q are the products of the numerators and the denominators. The halves are joined as P = P_left * P_right,
+  Q = Q_left * Q_right, T = T_left * Q_right + P_left * T_right.
+*/
+static void seriesBinarySplitting(int64_t left, int64_t right, const Integer &numerator, const Integer &denominator,
+                                  int64_t (*multiplier)(int64_t), Integer &product, Integer &denominatorsProduct,
+                                  Integer &sum) {
+  if (right - left == 1) {
+    product = numerator;
+    denominatorsProduct = denominator * multiplier(left);
+    sum = numerator;
+    return;
+  }
+
+  int64_t mid = (left + right) / 2;
+  Integer leftProduct;
+  Integer leftDenominatorsProduct;
+  Integer leftSum;
+  Integer rightProduct;
+  Integer rightDenominatorsProduct;
+  Integer rightSum;
+  seriesBinarySplitting(left, mid, numerator, denominator, multiplier, leftProduct, leftDenominatorsProduct, leftSum);
+  seriesBinarySplitting(mid, right, numerator, denominator, multiplier, rightProduct, rightDenominatorsProduct,
+                        rightSum);
+
+  sum = mulAdd(leftSum, rightDenominatorsProduct, leftProduct * rightSum);
+  product = leftProduct * rightProduct;
+  denominatorsProduct = leftDenominatorsProduct * rightDenominatorsProduct;
+}
+
+// e^a = prod_{j} e^(a_j), where e^(a_j) = 1 + sum_{k=1}^{inf} (p_j / q_j)^k / k!
+static BigFloat bitBurstExp(const Rational &rhs, size_t precision) {
+  auto multiplier = [](int64_t step) { return step; };
+
+  BigFloat res = 1;
+  for (const auto &[numerator, digitsNum] : splitBitBurst(rhs, precision)) {
+    res = (res * sumBitBurstSeries(numerator, Integer::pow10(digitsNum), multiplier, precision)).round(precision);
+  }
+  return res;
+}
+
+/*
+  sin(a_j) = a_j * (1 + sum_{k=1}^{inf} (-a_j^2)^k / (2k+1)!), cos(a_j) = 1 + sum_{k=1}^{inf} (-a_j^2)^k / (2k)!. The
+  parts are added by the formulas sin(a + b) = sin(a) * cos(b) + cos(a) * sin(b),
+  cos(a + b) = cos(a) * cos(b) - sin(a) * sin(b).
+*/
+static void bitBurstSinCos(const Rational &rhs, size_t precision, BigFloat &sinVal, BigFloat &cosVal) {
+  auto sinMultiplier = [](int64_t step) { return step * 2 * (step * 2 + 1); };
+  auto cosMultiplier = [](int64_t step) { return (step * 2 - 1) * step * 2; };
+
+  sinVal = 0;
+  cosVal = 1;
+  for (const auto &[numerator, digitsNum] : splitBitBurst(rhs, precision)) {
+    Integer numeratorSqr = -(numerator * numerator);
+    Integer denominatorSqr = Integer::pow10(digitsNum * 2);
+    BigFloat partSin = BigFloat(numerator, -(int64_t)digitsNum) *
+                       sumBitBurstSeries(numeratorSqr, denominatorSqr, sinMultiplier, precision);
+    BigFloat partCos = sumBitBurstSeries(numeratorSqr, denominatorSqr, cosMultiplier, precision);
+
+    BigFloat nextSin = (sinVal * partCos + cosVal * partSin).round(precision);
+    cosVal = (cosVal * partCos - sinVal * partSin).round(precision);
+    sinVal = nextSin;
+  }
+}
+
+/*
+  The value is computed only when the cached one is less precise, otherwise the cached one is rounded. Readers only
+  copy the pointer, a more precise value replaces the cached one unless another thread has cached an even more precise
+  value meanwhile.
+*/
+static Rational getCachedConstant(std::shared_ptr<const CachedConstant> &cache, size_t precision,
+                                  Rational (*computeConstant)(size_t)) {
+  std::shared_ptr<const CachedConstant> cached = std::atomic_load(&cache);
+  if (cached && cached->precision >= precision) {
+    return cached->precision == precision ? cached->value : cached->value.round(precision);
+  }
+
+  auto computed = std::make_shared<const CachedConstant>(CachedConstant{precision, computeConstant(precision)});
+  while ((!cached || cached->precision < precision) && !std::atomic_compare_exchange_weak(&cache, &cached, computed)) {
+  }
+  return computed->value;
+}
+
+/*
+  Using Taylor series: ln(a) = sum_{k=0}^{inf} (2/(2k+1)) * ((a-1)/(a+1))^(2k+1) for 1 <= a <= 10, agmLn for high
+  precisions. Otherwise ln(a) = -ln(1/a) or ln(a) = ln(a / 10^n) + n * ln(10). lnReduce takes up to 8 roots, the error
+  multiplied by 2^8 is covered by the digits of reducePrecision.
+*/
+static Rational computeLn(const Rational &rhs, size_t precision) {
+  const int64_t maxReducedVal = 10;
+  const size_t reduceDigitsNum = 3;
+
+  if (precision > LN_AGM_PRECISION) {
+    return agmLn(rhs, precision);
+  }
+  if (rhs < 1) {
+    return -computeLn(1 / rhs, precision);
+  }
+
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  if (rhs > maxReducedVal) {
+    auto order = (int64_t)rhs.getInteger().size() - 1;
+    Rational ln10 = functions::getLn10(newPrecision + std::to_string(order).size());
+    return (computeLn(rhs / Integer::pow10(order), newPrecision) + ln10 * order).round(precision);
+  }
+
+  size_t reducePrecision = newPrecision + reduceDigitsNum;
+  Integer multiplier;
+  BigFloat rhsStep = lnReduce(rhs, multiplier, reducePrecision);
+  rhsStep = (rhsStep - 1) / (rhsStep + 1);
+
+  BigFloat rhsSqr = (rhsStep * rhsStep).round(reducePrecision);
+  auto numerator = [](int64_t step) { return step * 2 - 1; };
+  auto denominator = [](int64_t step) { return step * 2 + 1; };
+  BigFloat res = rhsStep * sumSeries(rhsSqr, reducePrecision, numerator, denominator);
+
+  return (res.toRational() * multiplier * 2).round(precision);
+}
+
+/*
+  Using the AGM: ln(s) = pi / (2 * AGM(1, 4/s)) + O(1/s^2), where s = a * 2^m > 10^(precision/2). The AGM is
+  homogeneous, so ln(s) = pi * s / (2 * AGM(s, 4)), which keeps the significant digits of the small 4/s. The first
+  means are about sqrt(s), so 3/4 of the precision is kept after the point. Then ln(a) = ln(s) - m * ln(2), and
+  ln(2) = ln(2^(m+1)) / (m+1) itself.
+*/
+static Rational agmLn(const Rational &rhs, size_t precision) {
+  const double log2Of10 = 3.3219280948873623;
+
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  auto agmPrecision = (size_t)getNewPrecision(newPrecision - newPrecision / 4);
+  auto lhsOrder = getNewPrecision(newPrecision / 2);
+  auto rhsOrder = (int64_t)rhs.getNumerator().size() - (int64_t)rhs.getDenominator().size();
+  auto multiplier = std::max((int64_t)((double)(lhsOrder - rhsOrder) * log2Of10), int64_t(0));
+
+  BigFloat lhs(rhs * naturalPow(2, multiplier), agmPrecision, BigFloat::RoundingMode::HalfUp);
+  BigFloat agmLhs = lhs;
+  BigFloat agmRhs = 4;
+  BigFloat precisionVal(1, 1 - (int64_t)agmPrecision);
+
+  while (abs(agmLhs - agmRhs) > precisionVal) {
+    BigFloat agmProduct = agmLhs * agmRhs;
+    agmLhs = (agmLhs + agmRhs) / 2;
+    agmRhs = sqrt(agmProduct);
+  }
+
+  BigFloat res = BigFloat(functions::getPi(newPrecision), newPrecision, BigFloat::RoundingMode::HalfUp) * lhs;
+  res /= agmLhs + agmRhs;
+
+  if (rhs == 2) {
+    return (res / (multiplier + 1)).round(precision).toRational();
+  }
+  BigFloat ln2(functions::getLn2(newPrecision + std::to_string(multiplier).size()), newPrecision,
+               BigFloat::RoundingMode::HalfUp);
+  return (res - ln2 * multiplier).round(precision).toRational();
+}
+
+/*
+  Using binary splitting: e = 1 + sum_{k=1}^{n} 1/k! = 1 + P(0, n) / Q(0, n), where n! > 10^precision, so only one
+  division is done. The halves of the upper levels are computed in parallel.
+*/
+static Rational computeE(size_t precision) {
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  int64_t termsNum = 1;
+  for (double factorialDigitsNum = 0; factorialDigitsNum <= (double)newPrecision + 1; termsNum++) {
+    factorialDigitsNum += std::log10((double)(termsNum + 1));
+  }
+
+  Integer numerator;
+  Integer denominator;
+  eBinarySplitting(0, termsNum, numerator, denominator, std::max(std::thread::hardware_concurrency(), 1U));
+
+  BigFloat res = numerator + denominator;
+  res.setPrecision(newPrecision);
+  res /= denominator;
+  return res.round(precision).toRational();
+}
+
+/*
+  Using the Chudnovsky series:
+  pi = 426880 * sqrt(10005) / sum_{k=0}^{inf} (-1)^k * (6k)! * (13591409 + 545140134k) / ((3k)! * (k!)^3 * 640320^(3k)).
+
+  Each term adds about 14 digits. The sum of the first n terms is T(0, n) / Q(0, n) by binary splitting, so only one
+  division and one sqrt are done.
+*/
+static Rational computePi(size_t precision) {
+  const int64_t termDigitsNum = 14;
+  const int64_t sqrtVal = 10005;
+  const int64_t multiplier = 426880;
+
+  auto newPrecision = (size_t)getNewPrecision(precision);
+  auto termsNum = (int64_t)newPrecision / termDigitsNum + 2;
+
+  Integer product;
+  Integer denominator;
+  Integer numerator;
+  piBinarySplitting(0, termsNum, product, denominator, numerator, std::max(std::thread::hardware_concurrency(), 1U));
+
+  BigFloat res = sqrtVal;
+  res.setPrecision(newPrecision);
+  res = sqrt(res) * (denominator * multiplier);
+  res /= numerator;
+  return res.round(precision).toRational();
+}
+
+/*
+  sum_{k=left+1}^{right} left!/k! = P / Q, where Q = (left+1) * ... * right. The halves are joined as
+  P = P_left * Q_right + P_right, Q = Q_left * Q_right. The left half is computed in another thread while
+  threadsNum > 1.
+*/
+static void eBinarySplitting(int64_t left, int64_t right, Integer &numerator, Integer &denominator, size_t threadsNum) {
+  if (right - left == 1) {
+    numerator = 1;
+    denominator = right;
+    return;
+  }
+
+  int64_t mid = (left + right) / 2;
+  Integer leftNumerator;
+  Integer leftDenominator;
+  Integer rightNumerator;
+  Integer rightDenominator;
+
+  if (threadsNum > 1 && right - left > E_PARALLEL_TERMS_NUM) {
+    size_t leftThreadsNum = threadsNum / 2;
+    auto leftPart = std::async(std::launch::async, [&] {
+      eBinarySplitting(left, mid, leftNumerator, leftDenominator, leftThreadsNum);
+    });
+    eBinarySplitting(mid, right, rightNumerator, rightDenominator, threadsNum - leftThreadsNum);
+    leftPart.get();
+  } else {
+    eBinarySplitting(left, mid, leftNumerator, leftDenominator, 1);
+    eBinarySplitting(mid, right, rightNumerator, rightDenominator, 1);
+  }
+
+  numerator = mulAdd(leftNumerator, rightDenominator, rightNumerator);
+  denominator = leftDenominator * rightDenominator;
+}
+
+/*
+  The k-th term of the Chudnovsky series is a_k * (13591409 + 545140134k), where a_k = a_{k-1} * p_k / q_k,
+  p_k = -(6k-5)(2k-1)(6k-1) and q_k = k^3 * 640320^3 / 24. P and Q are the products of p_k and q_k for k from left to
+  right - 1, the sum of the terms is a_{left-1} * T / Q. The halves are joined as P = P_left * P_right,
+  Q = Q_left * Q_right, T = T_left * Q_right + P_left * T_right. The left half is computed in another thread while
+  threadsNum > 1.
+*/
+static void piBinarySplitting(int64_t left, int64_t right, Integer &product, Integer &denominator, Integer &numerator,
+                              size_t threadsNum) {
+  if (right - left == 1) {
+    const int64_t termAddend = 13591409;
+    const int64_t termMultiplier = 545140134;
+    const int64_t denominatorMultiplier = 10939058860032000;
+
+    if (left == 0) {
+      product = 1;
+      denominator = 1;
+      numerator = termAddend;
+      return;
+    }
+
+    product = Integer(5 - 6 * left) * (2 * left - 1) * (6 * left - 1);
+    denominator = Integer(left) * left * left * denominatorMultiplier;
+    numerator = product * (termAddend + termMultiplier * left);
+    return;
+  }
+
+  int64_t mid = (left + right) / 2;
+  Integer leftProduct;
+  Integer leftDenominator;
+  Integer leftNumerator;
+  Integer rightProduct;
+  Integer rightDenominator;
+  Integer rightNumerator;
+
+  if (threadsNum > 1 && right - left > PI_PARALLEL_TERMS_NUM) {
+    size_t leftThreadsNum = threadsNum / 2;
+    auto leftPart = std::async(std::launch::async, [&] {
+      piBinarySplitting(left, mid, leftProduct, leftDenominator, leftNumerator, leftThreadsNum);
+    });
+    piBinarySplitting(mid, right, rightProduct, rightDenominator, rightNumerator, threadsNum - leftThreadsNum);
+    leftPart.get();
+  } else {
+    piBinarySplitting(left, mid, leftProduct, leftDenominator, leftNumerator, 1);
+    piBinarySplitting(mid, right, rightProduct, rightDenominator, rightNumerator, 1);
+  }
+
+  numerator = mulAdd(leftNumerator, rightDenominator, leftProduct * rightNumerator);
+  product = leftProduct * rightProduct;
+  denominator = leftDenominator * rightDenominator;
+}
+
+// The functions calculated with the precision are less than a unit of the last digit away from the exact value
+static Rational getEvaluationError(size_t precision) {
+  return getInversedPrecisionVal(precision).toRational();
+}
+
+static Ball toBall(const Rational &val, const Ball &rhs, const Rational &derivative, const Rational &error) {
+  if (!rhs.isBounded()) {
+    return Ball::getUnbounded(val);
+  }
+  return {val, derivative * rhs.getRadius() + error};
+}
+
+/*
+  |tan'| = 1 + tan^2(a) = 1/cos^2(a), it is at most 2 * (1 + tan^2(a)) on the ball if 32r^2 <= cos^2(a), as |cos| does
+  not fall below cos(a) * (1 - 1/sqrt(32)) there. |tan(a)| is bounded by |val| + error. The same holds for cot(a).
+*/
+static Ball getTangentBall(const Rational &val, const Ball &rhs, size_t precision) {
+  const int64_t maxRadiusSqrMultiplier = 32;
+  const int64_t derivativeMultiplier = 2;
+
+  Rational error = getEvaluationError(precision);
+  if (!rhs.isBounded() || rhs.getRadius() == 0) {
+    return toBall(val, rhs, 0, error);
+  }
+
+  Rational maxAbs = functions::abs(val) + error;
+  Rational maxDerivative = 1 + maxAbs * maxAbs;
+  Rational radius = rhs.getRadius();
+  if (radius * radius * maxRadiusSqrMultiplier * maxDerivative > 1) {
+    return Ball::getUnbounded(val);
+  }
+  return toBall(val, rhs, maxDerivative * derivativeMultiplier, error);
+}
+
+/*
+  |asin'| = |acos'| = 1/sqrt(1 - a^2), on the ball it is at most 1/sqrt(1 - (|a| + r)^2). The truncated root is not
+  greater than the exact one, so its inverse bounds the derivative.
+*/
+static Ball getArcsineBall(const Rational &val, const Ball &rhs, size_t precision) {
+  Rational error = getEvaluationError(precision);
+  if (!rhs.isBounded() || rhs.getRadius() == 0) {
+    return toBall(val, rhs, 0, error);
+  }
+
+  Rational rhsAbs = functions::abs(rhs.getMidpoint());
+
+  Rational maxAbs = rhsAbs + rhs.getRadius();
+  if (maxAbs >= 1) {
+    return Ball::getUnbounded(val);
+  }
+  Rational sqrtVal = functions::sqrt(1 - maxAbs * maxAbs, precision);
+  if (sqrtVal == 0) {
+    return Ball::getUnbounded(val);
+  }
+  return toBall(val, rhs, 1 / sqrtVal, error);
+}
@@ -3,14 +3,22 @@
 
 #include <cstddef>
 
+#include "single_entities/terms/numbers/Ball.hpp"
 #include "single_entities/terms/numbers/Rational.hpp"
 
 namespace functions {
+// The constants are cached with the highest precision computed so far, lower precisions are served by rounding
 Rational getE(size_t precision);
+// Using the Chudnovsky series
 Rational getPi(size_t precision);
+// Using the Brent-Salamin AGM, slower than getPi
+Rational getPiAgm(size_t precision);
+Rational getLn2(size_t precision);
+Rational getLn10(size_t precision);
 
 Rational abs(const Rational &rhs);
 
+// The functions with the precision are less than a unit of its last digit away from the exact value
 Rational sqrt(const Rational &rhs, size_t precision);
 Rational pow(const Rational &lhs, const Rational &rhs, size_t precision);
 Rational exp(const Rational &rhs, size_t precision);
@@ -32,6 +40,34 @@ Rational acot(const Rational &rhs, size_t precision);
 
 Rational factorial(const Rational &rhs);
 Rational doubleFactorial(const Rational &rhs);
+
+/*
+  Ball versions bound the change of the function on the ball by its derivative and add the evaluation error of the
+  Rational version, a unit of the last digit.
+*/
+Ball abs(const Ball &rhs);
+
+Ball sqrt(const Ball &rhs, size_t precision);
+Ball pow(const Ball &lhs, const Ball &rhs, size_t precision);
+Ball exp(const Ball &rhs, size_t precision);
+
+Ball log(const Ball &lhs, const Ball &rhs, size_t precision);
+Ball ln(const Ball &rhs, size_t precision);
+Ball lb(const Ball &rhs, size_t precision);
+Ball lg(const Ball &rhs, size_t precision);
+
+Ball sin(const Ball &rhs, size_t precision);
+Ball cos(const Ball &rhs, size_t precision);
+Ball tan(const Ball &rhs, size_t precision);
+Ball cot(const Ball &rhs, size_t precision);
+
+Ball asin(const Ball &rhs, size_t precision);
+Ball acos(const Ball &rhs, size_t precision);
+Ball atan(const Ball &rhs, size_t precision);
+Ball acot(const Ball &rhs, size_t precision);
+
+Ball factorial(const Ball &rhs);
+Ball doubleFactorial(const Ball &rhs);
 } // namespace functions
 
 #endif // NAMESPACEFUNCTIONS_HPP
@@ -32,6 +32,23 @@ Rational Operator::solve(const Rational &lhs, const Rational &rhs, int64_t preci
   }
 }
 
+Ball Operator::solve(const Ball &lhs, const Ball &rhs, int64_t precision) const {
+  switch (name) {
+  case '+':
+    return lhs + rhs;
+  case '-':
+    return lhs - rhs;
+  case '*':
+    return lhs * rhs;
+  case '/':
+    return lhs / rhs;
+  case '^':
+    return functions::pow(lhs, rhs, precision);
+  default:
+    throw std::invalid_argument("Operator invalid input");
+  }
+}
+
 std::string Operator::getTypeName() const {
   return "Operator";
 }
@@ -5,6 +5,7 @@
 #include <string>
 
 #include "single_entities/ISingleEntity.hpp"
+#include "single_entities/terms/numbers/Ball.hpp"
 #include "single_entities/terms/numbers/Rational.hpp"
 
 class Operator : public ISingleEntity {
@@ -12,6 +13,7 @@ public:
   explicit Operator(const std::string &strOper);
 
   Rational solve(const Rational &lhs, const Rational &rhs, int64_t precision) const;
+  Ball solve(const Ball &lhs, const Ball &rhs, int64_t precision) const;
 
   std::string getTypeName() const override;
   std::string toString() const override;
@@ -0,0 +1,191 @@
+#include "single_entities/terms/numbers/Ball.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "single_entities/operators/NamespaceFunctions.hpp"
+
+// The number of significant digits kept in the radius
+constexpr int64_t RADIUS_DIGITS = 3;
+
+static BigFloat toRadius(const Rational &rhs);
+static BigFloat roundRadius(const BigFloat &rhs);
+
+Ball::Ball(Rational midpoint) : midpoint(std::move(midpoint)) {
+}
+
+Ball::Ball(Rational midpoint, const Rational &radius)
+    : midpoint(std::move(midpoint)), radius(toRadius(functions::abs(radius))) {
+}
+
+Ball Ball::getUnbounded(Rational midpoint) {
+  Ball val(std::move(midpoint));
+  val.isRadiusBounded = false;
+  return val;
+}
+
+Ball &Ball::operator+=(const Ball &rhs) {
+  midpoint += rhs.midpoint;
+  radius = roundRadius(radius + rhs.radius);
+  isRadiusBounded = isRadiusBounded && rhs.isRadiusBounded;
+  return *this;
+}
+
+Ball Ball::operator+(const Ball &rhs) const {
+  Ball tmpLhs = *this;
+  return tmpLhs += rhs;
+}
+
+Ball &Ball::operator-=(const Ball &rhs) {
+  return *this += -rhs;
+}
+
+Ball Ball::operator-(const Ball &rhs) const {
+  Ball tmpLhs = *this;
+  return tmpLhs -= rhs;
+}
+
+// |ab - AB| <= |a|*rB + |b|*rA + rA*rB
+Ball &Ball::operator*=(const Ball &rhs) {
+  if (!isRadiusBounded || !rhs.isRadiusBounded) {
+    midpoint *= rhs.midpoint;
+    isRadiusBounded = false;
+    return *this;
+  }
+
+  Rational lhsRadius = getRadius();
+  Rational rhsRadius = rhs.getRadius();
+  Rational error =
+      functions::abs(midpoint) * rhsRadius + functions::abs(rhs.midpoint) * lhsRadius + lhsRadius * rhsRadius;
+
+  midpoint *= rhs.midpoint;
+  radius = toRadius(error);
+  return *this;
+}
+
+Ball Ball::operator*(const Ball &rhs) const {
+  Ball tmpLhs = *this;
+  return tmpLhs *= rhs;
+}
+
+/*
+  |a/b - A/B| <= (|a|*rB + |b|*rA) / (|b| * (|b| - rB)) if |b| > rB. Only the division by the exact zero throws, the
+  result is unbounded if the ball B contains zero.
+*/
+Ball &Ball::operator/=(const Ball &rhs) {
+  if (rhs.midpoint == 0 && (!rhs.isRadiusBounded || rhs.radius != 0)) {
+    isRadiusBounded = false;
+    return *this;
+  }
+
+  Rational lhsMidpoint = midpoint;
+  midpoint /= rhs.midpoint;
+
+  if (!isRadiusBounded || !rhs.isRadiusBounded) {
+    isRadiusBounded = false;
+    return *this;
+  }
+
+  Rational rhsAbs = functions::abs(rhs.midpoint);
+  Rational rhsRadius = rhs.getRadius();
+  if (rhsAbs <= rhsRadius) {
+    isRadiusBounded = false;
+    return *this;
+  }
+
+  radius =
+      toRadius((functions::abs(lhsMidpoint) * rhsRadius + rhsAbs * getRadius()) / (rhsAbs * (rhsAbs - rhsRadius)));
+  return *this;
+}
+
+Ball Ball::operator/(const Ball &rhs) const {
+  Ball tmpLhs = *this;
+  return tmpLhs /= rhs;
+}
+
+Ball Ball::operator+() const {
+  return *this;
+}
+
+Ball Ball::operator-() const {
+  Ball val = *this;
+  val.midpoint = -val.midpoint;
+  return val;
+}
+
+Ball Ball::round(size_t precision) const {
+  Ball val = *this;
+  val.midpoint = midpoint.round(precision);
+  if (val.midpoint != midpoint) {
+    const int64_t halfDigit = 5;
+    val.radius = roundRadius(val.radius + BigFloat(halfDigit, -(int64_t)precision - 1));
+  }
+  return val;
+}
+
+const Rational &Ball::getMidpoint() const {
+  return midpoint;
+}
+
+Rational Ball::getRadius() const {
+  if (!isRadiusBounded) {
+    throw std::domain_error("Ball is unbounded");
+  }
+  return radius.toRational();
+}
+
+Rational Ball::getLower() const {
+  return midpoint - getRadius();
+}
+
+Rational Ball::getUpper() const {
+  return midpoint + getRadius();
+}
+
+bool Ball::isBounded() const {
+  return isRadiusBounded;
+}
+
+bool Ball::contains(const Rational &val) const {
+  return !isRadiusBounded || functions::abs(val - midpoint) <= getRadius();
+}
+
+std::string Ball::toString() const {
+  std::string radiusStr = isRadiusBounded ? radius.toRational().toString() : "inf";
+  return "[" + midpoint.toString() + " +- " + radiusStr + "]";
+}
+
+std::string Ball::getTypeName() const {
+  return "Ball";
+}
+
+// The upper bound of a non-negative number with RADIUS_DIGITS significant digits, integer digits are kept
+static BigFloat toRadius(const Rational &rhs) {
+  if (rhs == 0) {
+    return 0;
+  }
+
+  int64_t order = 0;
+  if (rhs >= 1) {
+    order = (int64_t)rhs.getInteger().size();
+  } else {
+    order = (int64_t)rhs.getNumerator().size() - (int64_t)rhs.getDenominator().size();
+  }
+
+  auto precision = (size_t)std::max(RADIUS_DIGITS - order, int64_t(0));
+  return roundRadius(BigFloat(rhs, precision, BigFloat::RoundingMode::Up));
+}
+
+static BigFloat roundRadius(const BigFloat &rhs) {
+  auto extraDigitsNum = (int64_t)rhs.getMantissa().size() - RADIUS_DIGITS;
+  int64_t precision = -(rhs.getExponent() + extraDigitsNum);
+  if (extraDigitsNum <= 0 || precision < 0) {
+    return rhs;
+  }
+
+  BigFloat val = rhs;
+  val.setRoundingMode(BigFloat::RoundingMode::Up);
+  return val.round((size_t)precision);
+}
@@ -0,0 +1,58 @@
+/*
+  Ball is a midpoint with an error radius, the exact value lies in [midpoint - radius, midpoint + radius]. The radius is
+  a BigFloat of a few digits rounded up, so tracking the error costs little next to the midpoint. The radius becomes
+  unbounded when no bound can be given, for example after the division by a ball containing zero.
+*/
+#ifndef BALL_HPP
+#define BALL_HPP
+
+#include <string>
+
+#include "single_entities/ISingleEntity.hpp"
+#include "single_entities/terms/numbers/BigFloat.hpp"
+#include "single_entities/terms/numbers/Rational.hpp"
+
+class Ball : public ISingleEntity {
+public:
+  Ball() = default;
+  // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
+  Ball(Rational midpoint);
+  Ball(Rational midpoint, const Rational &radius);
+
+  static Ball getUnbounded(Rational midpoint);
+
+  Ball &operator+=(const Ball &rhs);
+  Ball operator+(const Ball &rhs) const;
+
+  Ball &operator-=(const Ball &rhs);
+  Ball operator-(const Ball &rhs) const;
+
+  Ball &operator*=(const Ball &rhs);
+  Ball operator*(const Ball &rhs) const;
+
+  Ball &operator/=(const Ball &rhs);
+  Ball operator/(const Ball &rhs) const;
+
+  Ball operator+() const;
+  Ball operator-() const;
+
+  Ball round(size_t precision) const;
+
+  const Rational &getMidpoint() const;
+  Rational getRadius() const;
+  Rational getLower() const;
+  Rational getUpper() const;
+
+  bool isBounded() const;
+  bool contains(const Rational &val) const;
+
+  std::string toString() const override;
+  std::string getTypeName() const override;
+
+private:
+  Rational midpoint;
+  BigFloat radius;
+  bool isRadiusBounded = true;
+};
+
+#endif // BALL_HPP
@@ -0,0 +1,265 @@
+#include "single_entities/terms/numbers/BigFloat.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+static Integer divide(const Integer &lhs, const Integer &rhs, BigFloat::RoundingMode roundingMode);
+
+BigFloat::BigFloat(Integer val) : mantissa(std::move(val)) {
+}
+
+BigFloat::BigFloat(int64_t val) : mantissa(val) {
+}
+
+BigFloat::BigFloat(Integer mantissa, int64_t exponent) : mantissa(std::move(mantissa)), exponent(exponent) {
+}
+
+BigFloat::BigFloat(const Rational &val, size_t precision, RoundingMode roundingMode)
+    : exponent(-(int64_t)precision), precision(precision), roundingMode(roundingMode) {
+  bool isNegative = val < 0;
+  Rational scaledVal = (isNegative ? -val : val) * Integer::pow10(precision);
+
+  mantissa = scaledVal.getInteger();
+  Integer modNumerator = scaledVal.getNumerator();
+  if (modNumerator != 0 && (roundingMode == RoundingMode::Up ||
+                            (roundingMode == RoundingMode::HalfUp && modNumerator * 2 >= scaledVal.getDenominator()))) {
+    ++mantissa;
+  }
+
+  if (isNegative) {
+    mantissa = -mantissa;
+  }
+}
+
+BigFloat &BigFloat::operator+=(const BigFloat &rhs) {
+  if (exponent > rhs.exponent) {
+    mantissa = mulAdd(mantissa, Integer::pow10(exponent - rhs.exponent), rhs.mantissa);
+    exponent = rhs.exponent;
+  } else {
+    addMul(mantissa, rhs.mantissa, Integer::pow10(rhs.exponent - exponent));
+  }
+  updatePrecision(rhs);
+  return *this;
+}
+
+BigFloat BigFloat::operator+(const BigFloat &rhs) const {
+  BigFloat tmpLhs = *this;
+  return tmpLhs += rhs;
+}
+
+BigFloat &BigFloat::operator-=(const BigFloat &rhs) {
+  if (exponent > rhs.exponent) {
+    mantissa = mulAdd(mantissa, Integer::pow10(exponent - rhs.exponent), -rhs.mantissa);
+    exponent = rhs.exponent;
+  } else {
+    subMul(mantissa, rhs.mantissa, Integer::pow10(rhs.exponent - exponent));
+  }
+  updatePrecision(rhs);
+  return *this;
+}
+
+BigFloat BigFloat::operator-(const BigFloat &rhs) const {
+  BigFloat tmpLhs = *this;
+  return tmpLhs -= rhs;
+}
+
+BigFloat &BigFloat::operator*=(const BigFloat &rhs) {
+  mantissa *= rhs.mantissa;
+  exponent += rhs.exponent;
+  updatePrecision(rhs);
+  return *this;
+}
+
+BigFloat BigFloat::operator*(const BigFloat &rhs) const {
+  BigFloat tmpLhs = *this;
+  return tmpLhs *= rhs;
+}
+
+// A * 10^a / (B * 10^b) = (A * 10^(a - b + p) / B) * 10^(-p)
+BigFloat &BigFloat::operator/=(const BigFloat &rhs) {
+  if (rhs.mantissa == 0) {
+    throw std::domain_error("Div by zero");
+  }
+  updatePrecision(rhs);
+
+  int64_t shift = exponent - rhs.exponent + (int64_t)precision;
+  if (shift >= 0) {
+    mantissa = divide(mantissa * Integer::pow10(shift), rhs.mantissa, roundingMode);
+  } else {
+    mantissa = divide(mantissa, rhs.mantissa * Integer::pow10(-shift), roundingMode);
+  }
+  exponent = -(int64_t)precision;
+
+  return *this;
+}
+
+BigFloat BigFloat::operator/(const BigFloat &rhs) const {
+  BigFloat tmpLhs = *this;
+  return tmpLhs /= rhs;
+}
+
+BigFloat BigFloat::operator+() const {
+  return *this;
+}
+
+BigFloat BigFloat::operator-() const {
+  BigFloat val = *this;
+  val.mantissa = -val.mantissa;
+  return val;
+}
+
+bool BigFloat::operator==(const BigFloat &rhs) const {
+  return compare(*this, rhs) == 0;
+}
+
+bool BigFloat::operator!=(const BigFloat &rhs) const {
+  return compare(*this, rhs) != 0;
+}
+
+bool BigFloat::operator<(const BigFloat &rhs) const {
+  return compare(*this, rhs) < 0;
+}
+
+bool BigFloat::operator>(const BigFloat &rhs) const {
+  return compare(*this, rhs) > 0;
+}
+
+bool BigFloat::operator<=(const BigFloat &rhs) const {
+  return compare(*this, rhs) <= 0;
+}
+
+bool BigFloat::operator>=(const BigFloat &rhs) const {
+  return compare(*this, rhs) >= 0;
+}
+
+BigFloat abs(const BigFloat &rhs) {
+  if (rhs.mantissa < 0) {
+    return -rhs;
+  }
+  return rhs;
+}
+
+/*
+  sqrt(A * 10^a) = sqrt(A * 10^(a + 2p)) * 10^(-p). Rounding half up is done by the digit next to the last one, because
+  the root of the digits cut off is never less than the root truncated to one more digit.
+*/
+BigFloat sqrt(const BigFloat &rhs) {
+  if (rhs.mantissa < 0) {
+    throw std::domain_error("sqrt out of range");
+  }
+
+  int64_t shift = rhs.exponent + (int64_t)rhs.precision * 2;
+  if (rhs.roundingMode == BigFloat::RoundingMode::HalfUp) {
+    shift += 2;
+  }
+
+  Integer val;
+  bool isExact = true;
+  if (shift >= 0) {
+    val = rhs.mantissa * Integer::pow10(shift);
+  } else {
+    Integer divider = Integer::pow10(-shift);
+    val = rhs.mantissa / divider;
+    isExact = val * divider == rhs.mantissa;
+  }
+
+  Integer res = sqrt(val);
+  if (rhs.roundingMode == BigFloat::RoundingMode::HalfUp) {
+    const int64_t base = 10;
+    const int64_t roundUp = 5;
+    res = (res + roundUp) / base;
+  } else if (rhs.roundingMode == BigFloat::RoundingMode::Up && (!isExact || res * res != val)) {
+    ++res;
+  }
+
+  BigFloat resVal = rhs;
+  resVal.mantissa = res;
+  resVal.exponent = -(int64_t)rhs.precision;
+  return resVal;
+}
+
+BigFloat BigFloat::round(size_t precision_) const {
+  BigFloat val = *this;
+  val.precision = precision_;
+
+  int64_t shift = -(int64_t)precision_ - exponent;
+  if (shift > 0) {
+    val.mantissa = divide(mantissa, Integer::pow10(shift), roundingMode);
+    val.exponent = -(int64_t)precision_;
+  }
+
+  return val;
+}
+
+const Integer &BigFloat::getMantissa() const {
+  return mantissa;
+}
+
+int64_t BigFloat::getExponent() const {
+  return exponent;
+}
+
+size_t BigFloat::getPrecision() const {
+  return precision;
+}
+
+void BigFloat::setPrecision(size_t precision_) {
+  precision = precision_;
+}
+
+BigFloat::RoundingMode BigFloat::getRoundingMode() const {
+  return roundingMode;
+}
+
+void BigFloat::setRoundingMode(RoundingMode roundingMode_) {
+  roundingMode = roundingMode_;
+}
+
+Rational BigFloat::toRational() const {
+  if (exponent >= 0) {
+    return mantissa * Integer::pow10(exponent);
+  }
+  return Rational::fromDecimal(mantissa, (size_t)-exponent);
+}
+
+std::string BigFloat::toString() const {
+  return toRational().toString(precision);
+}
+
+std::string BigFloat::getTypeName() const {
+  return "BigFloat";
+}
+
+void BigFloat::updatePrecision(const BigFloat &rhs) {
+  if (rhs.precision > precision) {
+    precision = rhs.precision;
+    roundingMode = rhs.roundingMode;
+  }
+}
+
+int BigFloat::compare(const BigFloat &lhs, const BigFloat &rhs) {
+  Integer diff = (lhs - rhs).mantissa;
+  if (diff == 0) {
+    return 0;
+  }
+  return diff < 0 ? -1 : 1;
+}
+
+// Division of integers with the rounding of the quotient
+static Integer divide(const Integer &lhs, const Integer &rhs, BigFloat::RoundingMode roundingMode) {
+  bool isNegative = (lhs < 0) != (rhs < 0);
+  Integer lhsAbs = lhs < 0 ? -lhs : lhs;
+  Integer rhsAbs = rhs < 0 ? -rhs : rhs;
+
+  Integer val = lhsAbs / rhsAbs;
+  Integer modVal = lhsAbs;
+  subMul(modVal, val, rhsAbs);
+
+  if (modVal != 0 && (roundingMode == BigFloat::RoundingMode::Up ||
+                      (roundingMode == BigFloat::RoundingMode::HalfUp && modVal * 2 >= rhsAbs))) {
+    ++val;
+  }
+
+  return isNegative ? -val : val;
+}
@@ -0,0 +1,85 @@
+/*
+  BigFloat is stored as mantissa * 10^exponent. Addition, substraction and multiplication are exact, while division,
+  round and sqrt round the result to precision digits after the point, so no gcd is ever computed. The precision and
+  the rounding mode of a result are taken from the operand with the greater precision. Integers are exact and have zero
+  precision.
+*/
+#ifndef BIGFLOAT_HPP
+#define BIGFLOAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "single_entities/ISingleEntity.hpp"
+#include "single_entities/terms/numbers/Integer.hpp"
+#include "single_entities/terms/numbers/Rational.hpp"
+
+class BigFloat : public ISingleEntity {
+public:
+  enum class RoundingMode {
+    HalfUp, // to the nearest, ties away from zero like Rational::round
+    Down,   // towards zero
+    Up,     // away from zero
+  };
+
+  BigFloat() = default;
+  // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
+  BigFloat(Integer val);
+  // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
+  BigFloat(int64_t val);
+  BigFloat(Integer mantissa, int64_t exponent);
+  BigFloat(const Rational &val, size_t precision, RoundingMode roundingMode);
+
+  BigFloat &operator+=(const BigFloat &rhs);
+  BigFloat operator+(const BigFloat &rhs) const;
+
+  BigFloat &operator-=(const BigFloat &rhs);
+  BigFloat operator-(const BigFloat &rhs) const;
+
+  BigFloat &operator*=(const BigFloat &rhs);
+  BigFloat operator*(const BigFloat &rhs) const;
+
+  BigFloat &operator/=(const BigFloat &rhs);
+  BigFloat operator/(const BigFloat &rhs) const;
+
+  BigFloat operator+() const;
+  BigFloat operator-() const;
+
+  bool operator==(const BigFloat &rhs) const;
+  bool operator!=(const BigFloat &rhs) const;
+  bool operator<(const BigFloat &rhs) const;
+  bool operator>(const BigFloat &rhs) const;
+  bool operator<=(const BigFloat &rhs) const;
+  bool operator>=(const BigFloat &rhs) const;
+
+  friend BigFloat abs(const BigFloat &rhs);
+  friend BigFloat sqrt(const BigFloat &rhs);
+
+  BigFloat round(size_t precision) const;
+
+  const Integer &getMantissa() const;
+  int64_t getExponent() const;
+
+  size_t getPrecision() const;
+  void setPrecision(size_t precision_);
+
+  RoundingMode getRoundingMode() const;
+  void setRoundingMode(RoundingMode roundingMode_);
+
+  Rational toRational() const;
+
+  std::string toString() const override;
+  std::string getTypeName() const override;
+
+private:
+  Integer mantissa = 0;
+  int64_t exponent = 0;
+  size_t precision = 0;
+  RoundingMode roundingMode = RoundingMode::HalfUp;
+
+  void updatePrecision(const BigFloat &rhs);
+  static int compare(const BigFloat &lhs, const BigFloat &rhs);
+};
+
+#endif // BIGFLOAT_HPP
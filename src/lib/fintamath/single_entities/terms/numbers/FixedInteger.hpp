@@ -0,0 +1,511 @@
+/*
+  FixedInteger is stored as a sign and a magnitude of Bits bits in 64-bit digits going from low to high. All the
+  arithmetic is constexpr and works without heap allocations. It is meant for kernels with known bounds: operators throw
+  std::overflow_error when the result does not fit in Bits, tryAdd, trySubstract and tryMultiply return false instead.
+  PromotingInteger is used when the bounds are not known, it promotes itself to Integer on overflow. Both types are
+  mixed with Rational in the arithmetic and the comparisons.
+*/
+#ifndef FIXEDINTEGER_HPP
+#define FIXEDINTEGER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "single_entities/terms/numbers/Integer.hpp"
+#include "single_entities/terms/numbers/Rational.hpp"
+
+template <size_t Bits> class FixedInteger {
+  static_assert(Bits != 0 && Bits % 64 == 0, "FixedInteger size must be a multiple of 64 bits");
+
+public:
+  constexpr FixedInteger() = default;
+
+  // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
+  constexpr FixedInteger(int64_t val) : sign(val < 0) {
+    intArr[0] = val < 0 ? 0 - (uint64_t)val : (uint64_t)val;
+  }
+
+  explicit FixedInteger(const Integer &val) {
+    std::string strVal = val.toString();
+    size_t firstDigitNum = strVal.front() == '-' ? 1 : 0;
+    const int64_t base = 10;
+
+    for (size_t i = firstDigitNum; i < strVal.size(); i++) {
+      if (!tryMultiply(base) || !tryAdd(strVal[i] - '0')) {
+        throw std::overflow_error("FixedInteger overflow");
+      }
+    }
+
+    sign = firstDigitNum == 1;
+    fixZero();
+  }
+
+  constexpr bool tryAdd(const FixedInteger &rhs) {
+    if (sign == rhs.sign) {
+      return addToMagnitude(rhs.intArr);
+    }
+    substractFromMagnitude(rhs.intArr);
+    return true;
+  }
+
+  constexpr bool trySubstract(const FixedInteger &rhs) {
+    if (sign != rhs.sign) {
+      return addToMagnitude(rhs.intArr);
+    }
+    substractFromMagnitude(rhs.intArr);
+    return true;
+  }
+
+  constexpr bool tryMultiply(const FixedInteger &rhs) {
+    IntArray res{};
+
+    for (size_t i = 0; i < SIZE; i++) {
+      uint64_t carry = 0;
+      for (size_t j = 0; j < SIZE; j++) {
+        if (i + j >= SIZE) {
+          if (intArr[i] != 0 && rhs.intArr[j] != 0) {
+            return false;
+          }
+          continue;
+        }
+        DoubleDigit val = (DoubleDigit)intArr[i] * rhs.intArr[j] + res[i + j] + carry;
+        res[i + j] = (uint64_t)val;
+        carry = (uint64_t)(val >> DIGIT_BITS);
+      }
+      if (carry != 0) {
+        return false;
+      }
+    }
+
+    intArr = res;
+    sign = sign != rhs.sign;
+    fixZero();
+    return true;
+  }
+
+  constexpr FixedInteger &operator+=(const FixedInteger &rhs) {
+    if (!tryAdd(rhs)) {
+      throw std::overflow_error("FixedInteger overflow");
+    }
+    return *this;
+  }
+
+  constexpr FixedInteger operator+(const FixedInteger &rhs) const {
+    FixedInteger lhs = *this;
+    return lhs += rhs;
+  }
+
+  constexpr FixedInteger &operator-=(const FixedInteger &rhs) {
+    if (!trySubstract(rhs)) {
+      throw std::overflow_error("FixedInteger overflow");
+    }
+    return *this;
+  }
+
+  constexpr FixedInteger operator-(const FixedInteger &rhs) const {
+    FixedInteger lhs = *this;
+    return lhs -= rhs;
+  }
+
+  constexpr FixedInteger &operator*=(const FixedInteger &rhs) {
+    if (!tryMultiply(rhs)) {
+      throw std::overflow_error("FixedInteger overflow");
+    }
+    return *this;
+  }
+
+  constexpr FixedInteger operator*(const FixedInteger &rhs) const {
+    FixedInteger lhs = *this;
+    return lhs *= rhs;
+  }
+
+  constexpr FixedInteger operator+() const {
+    return *this;
+  }
+
+  constexpr FixedInteger operator-() const {
+    FixedInteger val = *this;
+    val.sign = !val.sign;
+    val.fixZero();
+    return val;
+  }
+
+  constexpr bool operator==(const FixedInteger &rhs) const {
+    return compare(rhs) == 0;
+  }
+
+  constexpr bool operator!=(const FixedInteger &rhs) const {
+    return compare(rhs) != 0;
+  }
+
+  constexpr bool operator<(const FixedInteger &rhs) const {
+    return compare(rhs) < 0;
+  }
+
+  constexpr bool operator>(const FixedInteger &rhs) const {
+    return compare(rhs) > 0;
+  }
+
+  constexpr bool operator<=(const FixedInteger &rhs) const {
+    return compare(rhs) <= 0;
+  }
+
+  constexpr bool operator>=(const FixedInteger &rhs) const {
+    return compare(rhs) >= 0;
+  }
+
+  // Horner's scheme over the 32-bit halves of the digits
+  Integer toInteger() const {
+    if (isInt64()) {
+      return sign ? -(int64_t)intArr[0] : (int64_t)intArr[0];
+    }
+
+    const int64_t halfBase = int64_t(1) << HALF_DIGIT_BITS;
+    const uint64_t halfMask = halfBase - 1;
+
+    Integer res = 0;
+    for (size_t i = SIZE - 1; i != SIZE_MAX; i--) {
+      res *= halfBase;
+      res += (int64_t)(intArr[i] >> HALF_DIGIT_BITS);
+      res *= halfBase;
+      res += (int64_t)(intArr[i] & halfMask);
+    }
+
+    return sign ? -res : res;
+  }
+
+  Rational toRational() const {
+    if (isInt64()) {
+      return sign ? -(int64_t)intArr[0] : (int64_t)intArr[0];
+    }
+    return Rational(toInteger());
+  }
+
+  std::string toString() const {
+    return toInteger().toString();
+  }
+
+private:
+  using DoubleDigit = unsigned __int128;
+
+  static constexpr size_t SIZE = Bits / 64;
+  static constexpr size_t DIGIT_BITS = 64;
+  static constexpr size_t HALF_DIGIT_BITS = 32;
+
+  using IntArray = std::array<uint64_t, SIZE>;
+
+  IntArray intArr{};
+  bool sign{};
+
+  constexpr void fixZero() {
+    if (isZero()) {
+      sign = false;
+    }
+  }
+
+  constexpr bool isZero() const {
+    for (size_t i = 0; i < SIZE; i++) {
+      if (intArr[i] != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  constexpr bool isInt64() const {
+    for (size_t i = 1; i < SIZE; i++) {
+      if (intArr[i] != 0) {
+        return false;
+      }
+    }
+    return intArr[0] <= (uint64_t)INT64_MAX;
+  }
+
+  static constexpr int compareMagnitudes(const IntArray &lhs, const IntArray &rhs) {
+    for (size_t i = SIZE - 1; i != SIZE_MAX; i--) {
+      if (lhs[i] != rhs[i]) {
+        return lhs[i] < rhs[i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+  constexpr int compare(const FixedInteger &rhs) const {
+    if (sign != rhs.sign) {
+      return sign ? -1 : 1;
+    }
+    int res = compareMagnitudes(intArr, rhs.intArr);
+    return sign ? -res : res;
+  }
+
+  // Column addition, the magnitude is not changed on overflow
+  constexpr bool addToMagnitude(const IntArray &rhs) {
+    IntArray res{};
+    uint64_t carry = 0;
+
+    for (size_t i = 0; i < SIZE; i++) {
+      DoubleDigit val = (DoubleDigit)intArr[i] + rhs[i] + carry;
+      res[i] = (uint64_t)val;
+      carry = (uint64_t)(val >> DIGIT_BITS);
+    }
+
+    if (carry != 0) {
+      return false;
+    }
+    intArr = res;
+    return true;
+  }
+
+  // Column substraction of the lesser magnitude from the greater one
+  constexpr void substractFromMagnitude(const IntArray &rhs) {
+    IntArray lhs = intArr;
+    IntArray tmpRhs = rhs;
+
+    if (compareMagnitudes(lhs, tmpRhs) < 0) {
+      lhs = rhs;
+      tmpRhs = intArr;
+      sign = !sign;
+    }
+
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < SIZE; i++) {
+      uint64_t val = lhs[i] - tmpRhs[i] - borrow;
+      borrow = (lhs[i] < tmpRhs[i] || (lhs[i] == tmpRhs[i] && borrow != 0)) ? 1 : 0;
+      intArr[i] = val;
+    }
+
+    fixZero();
+  }
+};
+
+/*
+  PromotingInteger keeps the value in FixedInteger<Bits> while the results fit and continues in Integer after the first
+  overflow, as Rational keeps small fractions in machine words. A promoted value is not converted back.
+*/
+template <size_t Bits> class PromotingInteger {
+public:
+  PromotingInteger() = default;
+
+  // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
+  PromotingInteger(int64_t val) : fixedVal(val) {
+  }
+
+  // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
+  PromotingInteger(const FixedInteger<Bits> &val) : fixedVal(val) {
+  }
+
+  explicit PromotingInteger(Integer val) {
+    if (val.size() <= FIXED_DIGITS_NUM) {
+      fixedVal = FixedInteger<Bits>(val);
+    } else {
+      integerVal = std::move(val);
+    }
+  }
+
+  PromotingInteger &operator+=(const PromotingInteger &rhs) {
+    if (!isPromoted() && !rhs.isPromoted() && fixedVal.tryAdd(rhs.fixedVal)) {
+      return *this;
+    }
+    integerVal = toInteger() + rhs.toInteger();
+    return *this;
+  }
+
+  PromotingInteger operator+(const PromotingInteger &rhs) const {
+    PromotingInteger lhs = *this;
+    return lhs += rhs;
+  }
+
+  PromotingInteger &operator-=(const PromotingInteger &rhs) {
+    if (!isPromoted() && !rhs.isPromoted() && fixedVal.trySubstract(rhs.fixedVal)) {
+      return *this;
+    }
+    integerVal = toInteger() - rhs.toInteger();
+    return *this;
+  }
+
+  PromotingInteger operator-(const PromotingInteger &rhs) const {
+    PromotingInteger lhs = *this;
+    return lhs -= rhs;
+  }
+
+  PromotingInteger &operator*=(const PromotingInteger &rhs) {
+    if (!isPromoted() && !rhs.isPromoted() && fixedVal.tryMultiply(rhs.fixedVal)) {
+      return *this;
+    }
+    integerVal = toInteger() * rhs.toInteger();
+    return *this;
+  }
+
+  PromotingInteger operator*(const PromotingInteger &rhs) const {
+    PromotingInteger lhs = *this;
+    return lhs *= rhs;
+  }
+
+  PromotingInteger operator+() const {
+    return *this;
+  }
+
+  PromotingInteger operator-() const {
+    PromotingInteger val;
+    if (isPromoted()) {
+      val.integerVal = -*integerVal;
+    } else {
+      val.fixedVal = -fixedVal;
+    }
+    return val;
+  }
+
+  bool operator==(const PromotingInteger &rhs) const {
+    return compare(rhs) == 0;
+  }
+
+  bool operator!=(const PromotingInteger &rhs) const {
+    return compare(rhs) != 0;
+  }
+
+  bool operator<(const PromotingInteger &rhs) const {
+    return compare(rhs) < 0;
+  }
+
+  bool operator>(const PromotingInteger &rhs) const {
+    return compare(rhs) > 0;
+  }
+
+  bool operator<=(const PromotingInteger &rhs) const {
+    return compare(rhs) <= 0;
+  }
+
+  bool operator>=(const PromotingInteger &rhs) const {
+    return compare(rhs) >= 0;
+  }
+
+  bool isPromoted() const {
+    return integerVal.has_value();
+  }
+
+  Integer toInteger() const {
+    return isPromoted() ? *integerVal : fixedVal.toInteger();
+  }
+
+  Rational toRational() const {
+    return isPromoted() ? Rational(*integerVal) : fixedVal.toRational();
+  }
+
+  std::string toString() const {
+    return toInteger().toString();
+  }
+
+private:
+  // Integers of up to this number of digits fit in Bits, 0.30102 < log10(2)
+  static constexpr size_t FIXED_DIGITS_NUM = Bits * 30102 / 100000;
+
+  FixedInteger<Bits> fixedVal;
+  std::optional<Integer> integerVal;
+
+  int compare(const PromotingInteger &rhs) const {
+    if (!isPromoted() && !rhs.isPromoted()) {
+      return fixedVal < rhs.fixedVal ? -1 : (fixedVal == rhs.fixedVal ? 0 : 1);
+    }
+    Integer lhsVal = toInteger();
+    Integer rhsVal = rhs.toInteger();
+    return lhsVal < rhsVal ? -1 : (lhsVal == rhsVal ? 0 : 1);
+  }
+};
+
+template <typename T> struct IsFixedInteger : std::false_type {};
+template <size_t Bits> struct IsFixedInteger<FixedInteger<Bits>> : std::true_type {};
+template <size_t Bits> struct IsFixedInteger<PromotingInteger<Bits>> : std::true_type {};
+
+/*
+  Mixed arithmetic and comparisons with Rational. The operators are templates, so the non-template operators of the
+  fixed types are preferred for the other arguments.
+*/
+template <typename T> using EnableIfFixedInteger = std::enable_if_t<IsFixedInteger<T>::value, int>;
+
+template <typename T, EnableIfFixedInteger<T> = 0> Rational operator+(const T &lhs, const Rational &rhs) {
+  return lhs.toRational() + rhs;
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> Rational operator+(const Rational &lhs, const T &rhs) {
+  return lhs + rhs.toRational();
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> Rational operator-(const T &lhs, const Rational &rhs) {
+  return lhs.toRational() - rhs;
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> Rational operator-(const Rational &lhs, const T &rhs) {
+  return lhs - rhs.toRational();
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> Rational operator*(const T &lhs, const Rational &rhs) {
+  return lhs.toRational() * rhs;
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> Rational operator*(const Rational &lhs, const T &rhs) {
+  return lhs * rhs.toRational();
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> Rational operator/(const T &lhs, const Rational &rhs) {
+  return lhs.toRational() / rhs;
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> Rational operator/(const Rational &lhs, const T &rhs) {
+  return lhs / rhs.toRational();
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator==(const T &lhs, const Rational &rhs) {
+  return lhs.toRational() == rhs;
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator==(const Rational &lhs, const T &rhs) {
+  return lhs == rhs.toRational();
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator!=(const T &lhs, const Rational &rhs) {
+  return lhs.toRational() != rhs;
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator!=(const Rational &lhs, const T &rhs) {
+  return lhs != rhs.toRational();
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator<(const T &lhs, const Rational &rhs) {
+  return lhs.toRational() < rhs;
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator<(const Rational &lhs, const T &rhs) {
+  return lhs < rhs.toRational();
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator>(const T &lhs, const Rational &rhs) {
+  return lhs.toRational() > rhs;
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator>(const Rational &lhs, const T &rhs) {
+  return lhs > rhs.toRational();
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator<=(const T &lhs, const Rational &rhs) {
+  return lhs.toRational() <= rhs;
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator<=(const Rational &lhs, const T &rhs) {
+  return lhs <= rhs.toRational();
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator>=(const T &lhs, const Rational &rhs) {
+  return lhs.toRational() >= rhs;
+}
+
+template <typename T, EnableIfFixedInteger<T> = 0> bool operator>=(const Rational &lhs, const T &rhs) {
+  return lhs >= rhs.toRational();
+}
+
+#endif // FIXEDINTEGER_HPP
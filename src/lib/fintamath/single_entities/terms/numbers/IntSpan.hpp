@@ -0,0 +1,70 @@
+/*
+  IntSpan is a read-only view of Integer digits, from low to high, that are owned by a std::vector or by the block of a
+  big Rational. The arithmetic kernels of Integer read their operands through it, so the digits are never copied to be
+  read.
+*/
+#ifndef INTSPAN_HPP
+#define INTSPAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+class IntSpan {
+public:
+  IntSpan() = default;
+
+  IntSpan(const int64_t *digits_, size_t digitsNum_) : digits(digits_), digitsNum(digitsNum_) {
+  }
+
+  // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
+  template <typename Allocator> IntSpan(const std::vector<int64_t, Allocator> &rhs) : IntSpan(rhs.data(), rhs.size()) {
+  }
+
+  const int64_t &operator[](size_t pos) const {
+    return digits[pos];
+  }
+
+  const int64_t *data() const {
+    return digits;
+  }
+
+  size_t size() const {
+    return digitsNum;
+  }
+
+  bool empty() const {
+    return digitsNum == 0;
+  }
+
+  const int64_t &front() const {
+    return digits[0];
+  }
+
+  const int64_t &back() const {
+    return digits[digitsNum - 1];
+  }
+
+  const int64_t *begin() const {
+    return digits;
+  }
+
+  const int64_t *end() const {
+    return digits + digitsNum;
+  }
+
+  std::reverse_iterator<const int64_t *> rbegin() const {
+    return std::reverse_iterator<const int64_t *>(end());
+  }
+
+  std::reverse_iterator<const int64_t *> rend() const {
+    return std::reverse_iterator<const int64_t *>(begin());
+  }
+
+private:
+  const int64_t *digits = nullptr;
+  size_t digitsNum = 0;
+};
+
+#endif // INTSPAN_HPP
@@ -1,83 +1,156 @@
 /*
-  Integer is stored as a std::vector with bits going from low to high
+  Integer is stored as a std::vector with bits going from low to high. The vector is shared between copies and is copied
+  only when one of them is changed. An Integer made by Rational may borrow the digits from its block instead.
 */
 #include "single_entities/terms/numbers/Integer.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <ext/alloc_traits.h>
 #include <iterator>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <unistd.h>
+#include <unordered_map>
 #include <vector>
 
-using IntVector = std::vector<int64_t>;
+using IntVector = std::vector<int64_t, SpillAllocator<int64_t>>;
+using NttVector = std::vector<uint64_t, SpillAllocator<uint64_t>>;
+using NttWord = unsigned __int128;
 
 constexpr int8_t INT_BASE_SIZE = 9;
 constexpr int64_t INT_BASE = 1000000000;
+constexpr size_t INT64_DIGITS_NUM = 18;
 constexpr int64_t KARATSUBA_CUTOFF = 64;
+constexpr int64_t NTT_CUTOFF = 1024;
+constexpr size_t NTT_BLOCK_SIZE = 1 << 14;
+constexpr size_t NEWTON_DIVIDE_CUTOFF = 4096;
+constexpr size_t NEWTON_RECIPROCAL_CUTOFF = 64;
+constexpr size_t NEWTON_SQRT_CUTOFF = 8;
+constexpr size_t STREAM_BUFFER_SIZE = 4096;
+constexpr size_t POW10_CACHE_LIMIT = 1000;
 
-static IntVector toIntVector(const std::string &strVal, int64_t baseSize);
-static bool canConvert(const std::string &strVal);
-static std::string toString(const IntVector &intVect, int64_t baseSize);
+constexpr uint64_t NTT_MOD = 4179340454199820289ULL;
+constexpr uint64_t NTT_ROOT = 3;
+constexpr int64_t NTT_BASE = 1000;
+constexpr int64_t NTT_DIGITS_IN_BASE = 3;
 
-static int64_t firstZeroNum(const IntVector &rhs);
-
-static void toSignificantDigits(IntVector &rhs);
-static void toBasePositive(IntVector &rhs, size_t pos, int64_t base);
-static void toBaseNegative(IntVector &rhs, size_t pos, int64_t base);
+// -NTT_MOD^(-1) mod 2^64 by Newton's iteration, NTT_MOD is its own inverse mod 2^3
+static constexpr uint64_t getNttModInversed() {
+  uint64_t val = NTT_MOD;
+  for (int64_t i = 0; i < 5; i++) {
+    val *= 2 - NTT_MOD * val;
+  }
+  return 0 - val;
+}
 
-static bool equal(const IntVector &lhs, const IntVector &rhs);
-static bool less(const IntVector &lhs, const IntVector &rhs);
-static bool greater(const IntVector &lhs, const IntVector &rhs);
-static bool lessEqual(const IntVector &lhs, const IntVector &rhs);
-static bool greaterEqual(const IntVector &lhs, const IntVector &rhs);
+constexpr uint64_t NTT_MOD_INVERSED = getNttModInversed();
 
-static IntVector add(const IntVector &lhs, const IntVector &rhs, int64_t base);
-static IntVector addToSignificantDigits(const IntVector &lhs, const IntVector &rhs, int64_t base);
+static IntVector toIntVector(std::string_view strVal, int64_t baseSize);
+static bool canConvert(std::string_view strVal);
+static std::string toString(IntSpan intVect, int64_t baseSize);
+static void toStream(std::ostream &out, IntSpan intVect, int64_t baseSize);
+static size_t writeDigit(char *buff, int64_t digit, int64_t baseSize, bool isPadded);
 
-static IntVector substract(const IntVector &lhs, const IntVector &rhs, int64_t base);
+static int64_t firstZeroNum(IntSpan rhs);
 
-static IntVector shortMultiply(const IntVector &lhs, int64_t rhs, int64_t base);
-static IntVector polynomialMultiply(const IntVector &lhs, const IntVector &rhs, int64_t base);
-static IntVector karatsubaMultiply(const IntVector &lhs, const IntVector &rhs, int64_t base);
-static size_t zerosMultiply(IntVector &lhs, IntVector &rhs);
-static IntVector multiply(const IntVector &lhs, const IntVector &rhs, int64_t base);
+static void toSignificantDigits(IntVector &rhs);
+static void toBasePositive(IntVector &rhs, size_t pos, int64_t base);
+static void toBaseNegative(IntVector &rhs, size_t pos, int64_t base);
 
-static IntVector shortDivide(const IntVector &lhs, int64_t rhs, int64_t base);
-static IntVector shortDivide(const IntVector &lhs, int64_t rhs, IntVector &modVal, int64_t base);
+static bool equal(IntSpan lhs, IntSpan rhs);
+static bool less(IntSpan lhs, IntSpan rhs);
+static bool greater(IntSpan lhs, IntSpan rhs);
+static bool lessEqual(IntSpan lhs, IntSpan rhs);
+static bool greaterEqual(IntSpan lhs, IntSpan rhs);
+
+static IntVector add(IntSpan lhs, IntSpan rhs, int64_t base);
+static IntVector addToSignificantDigits(IntSpan lhs, IntSpan rhs, int64_t base);
+
+static IntVector substract(IntSpan lhs, IntSpan rhs, int64_t base);
+
+static IntVector shortMultiply(IntSpan lhs, int64_t rhs, int64_t base);
+static IntVector polynomialMultiply(IntSpan lhs, IntSpan rhs, int64_t base);
+static void polynomialMultiplyAdd(IntVector &res, IntSpan lhs, IntSpan rhs, int64_t base);
+static IntVector karatsubaMultiply(IntSpan lhs, IntSpan rhs, int64_t base);
+static IntVector nttMultiply(IntSpan lhs, IntSpan rhs);
+static uint64_t montReduce(NttWord val);
+static uint64_t montMultiply(uint64_t lhs, uint64_t rhs);
+static uint64_t toMont(uint64_t val);
+static uint64_t powMod(uint64_t lhs, uint64_t rhs);
+static NttVector getNttRoots(size_t size, bool isInversed);
+static void ntt(NttVector &vect, const NttVector &roots);
+static void inverseNtt(NttVector &vect, const NttVector &roots);
+static void nttPass(uint64_t *vect, size_t size, size_t len, const NttVector &roots);
+static void inverseNttPass(uint64_t *vect, size_t size, size_t len, const NttVector &roots);
+static NttVector toNttVector(IntSpan rhs, size_t size);
+static size_t zerosMultiply(IntSpan &lhs, IntSpan &rhs);
+static IntVector multiply(IntSpan lhs, IntSpan rhs, int64_t base);
+
+static IntVector shortDivide(IntSpan lhs, int64_t rhs, int64_t base);
+static IntVector shortDivide(IntSpan lhs, int64_t rhs, IntVector &modVal, int64_t base);
 static void zerosDivide(IntVector &lhs, IntVector &rhs);
-static IntVector binsearchDivide(const IntVector &lhs, const IntVector &rhs, IntVector &left, IntVector &right,
-                                 int64_t base);
-static IntVector divide(const IntVector &lhs, const IntVector &rhs, IntVector &modVal, int64_t base);
-
-static IntVector sqrt(const IntVector &rhs);
-static void getSqrtDiff(const IntVector &rhs, const int64_t &base, IntVector &val, IntVector &diff);
+static IntVector longDivide(IntSpan lhs, IntSpan rhs, IntVector &modVal, int64_t base);
+static IntVector shiftRight(IntSpan rhs, size_t digitsNum);
+static IntVector reciprocal(IntSpan rhs, int64_t base);
+static IntVector newtonDivide(IntSpan lhs, IntSpan rhs, IntVector &modVal, int64_t base);
+static IntVector divide(IntSpan lhs, IntSpan rhs, IntVector &modVal, int64_t base);
+static IntVector exactDivide(IntSpan lhs, IntSpan rhs, int64_t base);
+static int64_t inverseModBase(int64_t rhs, int64_t base);
+
+static IntVector sqrt(IntSpan rhs);
+static void getSqrtDiff(IntSpan rhs, const int64_t &base, IntVector &val, IntVector &diff);
+
+Integer::Integer(std::string_view strVal) {
+  if (!strVal.empty() && strVal.front() == '-') {
+    sign = true;
+    strVal.remove_prefix(1);
+  }
 
-Integer::Integer(const std::string &strVal) {
-  if (strVal.empty()) {
+  if (strVal.empty() || !canConvert(strVal)) {
     throw std::invalid_argument("Integer invalid input");
   }
 
-  intVect.clear();
-  sign = false;
+  setIntVect(toIntVector(strVal, INT_BASE_SIZE));
+  fixZero();
+}
 
-  int64_t firstDigitNum = 0;
-  if (strVal.front() == '-') {
-    sign = true;
-    firstDigitNum++;
-  }
+Integer::Integer(int64_t val) : intVect(std::make_shared<IntVector>()), sign(val < 0) {
+  // The magnitude of INT64_MIN does not fit in int64_t
+  uint64_t absVal = val < 0 ? -(uint64_t)val : (uint64_t)val;
+  do {
+    intVect->push_back((int64_t)(absVal % INT_BASE));
+    absVal /= INT_BASE;
+  } while (absVal != 0);
+}
 
-  if (!canConvert(strVal.substr(firstDigitNum))) {
-    throw std::invalid_argument("Integer invalid input");
+Integer::Integer(IntSpan digits, bool isBorrowed) {
+  if (isBorrowed) {
+    borrowedVect = digits;
+  } else {
+    intVect = std::make_shared<IntVector>(digits.begin(), digits.end());
   }
+}
 
-  intVect = toIntVector(strVal.substr(firstDigitNum), INT_BASE_SIZE);
+Integer::Integer(const Integer &rhs) : ISingleEntity(rhs), intVect(rhs.intVect), sign(rhs.sign) {
+  if (!intVect && !rhs.borrowedVect.empty()) {
+    intVect = std::make_shared<IntVector>(rhs.borrowedVect.begin(), rhs.borrowedVect.end());
+  }
 }
 
-Integer::Integer(int64_t val) : Integer(std::to_string(val)) {
+Integer &Integer::operator=(const Integer &rhs) {
+  if (this != &rhs) {
+    *this = Integer(rhs);
+  }
+  return *this;
 }
 
 Integer &Integer::operator=(int64_t rhs) {
@@ -86,15 +159,15 @@ Integer &Integer::operator=(int64_t rhs) {
 
 Integer &Integer::operator+=(const Integer &rhs) {
   if ((!sign && !rhs.sign) || (sign && rhs.sign)) {
-    intVect = addToSignificantDigits(intVect, rhs.intVect, INT_BASE);
+    setIntVect(addToSignificantDigits(getIntVect(), rhs.getIntVect(), INT_BASE));
   }
 
   else {
-    if (::greater(intVect, rhs.intVect)) {
-      intVect = substract(intVect, rhs.intVect, INT_BASE);
+    if (::greater(getIntVect(), rhs.getIntVect())) {
+      setIntVect(substract(getIntVect(), rhs.getIntVect(), INT_BASE));
     } else {
       sign = !sign;
-      intVect = substract(rhs.intVect, intVect, INT_BASE);
+      setIntVect(substract(rhs.getIntVect(), getIntVect(), INT_BASE));
     }
   }
 
@@ -143,7 +216,7 @@ Integer operator-(int64_t lhs, const Integer &rhs) {
 }
 
 Integer &Integer::operator*=(const Integer &rhs) {
-  intVect = multiply(intVect, rhs.intVect, INT_BASE);
+  setIntVect(multiply(getIntVect(), rhs.getIntVect(), INT_BASE));
   sign = !((sign && rhs.sign) || (!sign && !rhs.sign));
   fixZero();
   return *this;
@@ -173,13 +246,13 @@ Integer &Integer::operator/=(const Integer &rhs) {
   if (*this == 0) {
     return *this;
   }
-  if (::greater(rhs.intVect, intVect)) {
+  if (::greater(rhs.getIntVect(), getIntVect())) {
     *this = 0;
     return *this;
   }
 
   IntVector modVal;
-  intVect = divide(intVect, rhs.intVect, modVal, INT_BASE);
+  setIntVect(divide(getIntVect(), rhs.getIntVect(), modVal, INT_BASE));
   sign = !((sign && rhs.sign) || (!sign && !rhs.sign));
 
   fixZero();
@@ -210,11 +283,13 @@ Integer &Integer::operator%=(const Integer &rhs) {
   if (*this == 0) {
     return *this;
   }
-  if (::greater(rhs.intVect, intVect)) {
+  if (::greater(rhs.getIntVect(), getIntVect())) {
     return *this;
   }
 
-  divide(intVect, rhs.intVect, intVect, INT_BASE);
+  IntVector modVal;
+  divide(getIntVect(), rhs.getIntVect(), modVal, INT_BASE);
+  setIntVect(std::move(modVal));
 
   fixZero();
   return *this;
@@ -237,6 +312,24 @@ Integer operator%(int64_t lhs, const Integer &rhs) {
   return Integer(lhs) % rhs;
 }
 
+// The division must be exact, otherwise the result is unspecified
+Integer &Integer::divExact(const Integer &rhs) {
+  if (rhs == 0) {
+    throw std::domain_error("Div by zero");
+  }
+  if (*this == 0) {
+    return *this;
+  }
+
+  if (!(rhs.getIntVect().size() == 1 && rhs.getIntVect().front() == 1)) {
+    setIntVect(exactDivide(getIntVect(), rhs.getIntVect(), INT_BASE));
+  }
+  sign = !((sign && rhs.sign) || (!sign && !rhs.sign));
+
+  fixZero();
+  return *this;
+}
+
 Integer &Integer::operator++() {
   return *this += 1;
 }
@@ -271,15 +364,15 @@ bool Integer::operator==(const Integer &rhs) const {
   if (sign != rhs.sign) {
     return false;
   }
-  return equal(intVect, rhs.intVect);
+  return equal(getIntVect(), rhs.getIntVect());
 }
 
 bool Integer::operator==(int64_t rhs) const {
-  return *this == Integer(rhs);
+  return compare(*this, rhs) == 0;
 }
 
 bool operator==(int64_t lhs, const Integer &rhs) {
-  return Integer(lhs) == rhs;
+  return Integer::compare(rhs, lhs) == 0;
 }
 
 bool Integer::operator!=(const Integer &rhs) const {
@@ -303,18 +396,18 @@ bool Integer::operator<(const Integer &rhs) const {
   }
 
   if (sign && rhs.sign) {
-    return ::less(rhs.intVect, intVect);
+    return ::less(rhs.getIntVect(), getIntVect());
   }
 
-  return ::less(intVect, rhs.intVect);
+  return ::less(getIntVect(), rhs.getIntVect());
 }
 
 bool Integer::operator<(int64_t rhs) const {
-  return *this < Integer(rhs);
+  return compare(*this, rhs) < 0;
 }
 
 bool operator<(int64_t lhs, const Integer &rhs) {
-  return Integer(lhs) < rhs;
+  return Integer::compare(rhs, lhs) > 0;
 }
 
 bool Integer::operator>(const Integer &rhs) const {
@@ -326,18 +419,18 @@ bool Integer::operator>(const Integer &rhs) const {
   }
 
   if (sign && rhs.sign) {
-    return ::greater(rhs.intVect, intVect);
+    return ::greater(rhs.getIntVect(), getIntVect());
   }
 
-  return ::greater(intVect, rhs.intVect);
+  return ::greater(getIntVect(), rhs.getIntVect());
 }
 
 bool Integer::operator>(int64_t rhs) const {
-  return *this > Integer(rhs);
+  return compare(*this, rhs) > 0;
 }
 
 bool operator>(int64_t lhs, const Integer &rhs) {
-  return Integer(lhs) > rhs;
+  return Integer::compare(rhs, lhs) < 0;
 }
 
 bool Integer::operator<=(const Integer &rhs) const {
@@ -349,18 +442,18 @@ bool Integer::operator<=(const Integer &rhs) const {
   }
 
   if (sign && rhs.sign) {
-    return ::lessEqual(rhs.intVect, intVect);
+    return ::lessEqual(rhs.getIntVect(), getIntVect());
   }
 
-  return ::lessEqual(intVect, rhs.intVect);
+  return ::lessEqual(getIntVect(), rhs.getIntVect());
 }
 
 bool Integer::operator<=(int64_t rhs) const {
-  return *this <= Integer(rhs);
+  return compare(*this, rhs) <= 0;
 }
 
 bool operator<=(int64_t lhs, const Integer &rhs) {
-  return Integer(lhs) <= rhs;
+  return Integer::compare(rhs, lhs) >= 0;
 }
 
 bool Integer::operator>=(const Integer &rhs) const {
@@ -372,18 +465,18 @@ bool Integer::operator>=(const Integer &rhs) const {
   }
 
   if (sign && rhs.sign) {
-    return ::greaterEqual(rhs.intVect, intVect);
+    return ::greaterEqual(rhs.getIntVect(), getIntVect());
   }
 
-  return ::greaterEqual(intVect, rhs.intVect);
+  return ::greaterEqual(getIntVect(), rhs.getIntVect());
 }
 
 bool Integer::operator>=(int64_t rhs) const {
-  return *this >= Integer(rhs);
+  return compare(*this, rhs) >= 0;
 }
 
 bool operator>=(int64_t lhs, const Integer &rhs) {
-  return Integer(lhs) >= rhs;
+  return Integer::compare(rhs, lhs) <= 0;
 }
 
 std::istream &operator>>(std::istream &in, Integer &rhs) {
@@ -393,16 +486,73 @@ std::istream &operator>>(std::istream &in, Integer &rhs) {
   return in;
 }
 
+// Digits are written directly to the stream in chunks, without building the whole string
 std::ostream &operator<<(std::ostream &out, const Integer &rhs) {
-  return out << rhs.toString();
+  if (rhs.sign && !(rhs.getIntVect().size() == 1 && rhs.getIntVect().front() == 0)) {
+    out.put('-');
+  }
+  toStream(out, rhs.getIntVect(), INT_BASE_SIZE);
+  return out;
 }
 
 size_t Integer::size() const {
-  return (intVect.size() - 1) * INT_BASE_SIZE + (std::to_string(intVect.back())).size();
+  return (getIntVect().size() - 1) * INT_BASE_SIZE + (std::to_string(getIntVect().back())).size();
+}
+
+int64_t Integer::toInt64() const {
+  if (size() > INT64_DIGITS_NUM) {
+    throw std::out_of_range("Integer out of range");
+  }
+
+  int64_t val = 0;
+  for (auto iter = getIntVect().rbegin(); iter != getIntVect().rend(); ++iter) {
+    val = val * INT_BASE + *iter;
+  }
+  return sign ? -val : val;
+}
+
+// The digits of a power are written directly, the cache is read under a shared lock
+/*
+  The cache is bounded, because the exponents of the BigFloat alignment and of the parsed fractions change with the data.
+  Copies share the digits of the cached powers.
+*/
+Integer Integer::pow10(size_t rhs) {
+  static std::shared_mutex cacheMutex;
+  static std::unordered_map<size_t, Integer> cache;
+
+  if (rhs <= POW10_CACHE_LIMIT) {
+    std::shared_lock lock(cacheMutex);
+    auto iter = cache.find(rhs);
+    if (iter != cache.end()) {
+      return iter->second;
+    }
+  }
+
+  const int64_t base = 10;
+  IntVector intVect(rhs / INT_BASE_SIZE + 1, 0);
+  intVect.back() = 1;
+  for (size_t i = 0; i < rhs % INT_BASE_SIZE; i++) {
+    intVect.back() *= base;
+  }
+  Integer val;
+  val.setIntVect(std::move(intVect));
+
+  if (rhs <= POW10_CACHE_LIMIT) {
+    std::unique_lock lock(cacheMutex);
+    return cache.try_emplace(rhs, std::move(val)).first->second;
+  }
+  return val;
+}
+
+void Integer::setSpillDirectory(const std::string &directory, size_t minSize) {
+  if (!directory.empty() && access(directory.c_str(), W_OK) != 0) {
+    throw std::invalid_argument("Integer invalid spill directory");
+  }
+  SpillStore::setDirectory(directory, minSize);
 }
 
 std::string Integer::toString() const {
-  std::string strVal = ::toString(intVect, INT_BASE_SIZE);
+  std::string strVal = ::toString(getIntVect(), INT_BASE_SIZE);
   if (strVal != "0" && sign) {
     strVal.insert(0, 1, '-');
   }
@@ -413,53 +563,206 @@ std::string Integer::getTypeName() const {
   return "Integer";
 }
 
-// Changing the number base to solve sqrt
+/*
+  Changing the number base to solve sqrt of short numbers. For long ones the root r of the highest digits is found
+  first, then one Newton's step s = (r * base^k + A / (r * base^k)) / 2 gives all the digits but the last one. s is
+  never less than the root, so it is only decreased.
+*/
 Integer sqrt(const Integer &rhs) {
   if (rhs < 0) {
     throw std::domain_error("sqrt out of range");
   }
-  auto intVect = toIntVector(rhs.toString(), 2);
-  return Integer(toString(sqrt(intVect), 1));
+
+  IntSpan rhsVect = rhs.getIntVect();
+  if (rhsVect.size() < NEWTON_SQRT_CUTOFF) {
+    auto intVect = toIntVector(rhs.toString(), 2);
+    return Integer(toString(sqrt(intVect), 1));
+  }
+
+  size_t shift = (rhsVect.size() - 3) / 4;
+  Integer val;
+  val.setIntVect(shiftRight(rhsVect, shift * 2));
+  val = sqrt(val);
+
+  IntSpan valSpan = val.getIntVect();
+  IntVector valVect(valSpan.begin(), valSpan.end());
+  valVect.insert(valVect.begin(), shift, 0);
+  val.setIntVect(std::move(valVect));
+
+  val = (val + rhs / val) / 2;
+  while (val * val > rhs) {
+    --val;
+  }
+  return val;
+}
+
+// res += lhs * rhs
+Integer &addMul(Integer &res, const Integer &lhs, const Integer &rhs) {
+  return res.addProduct(lhs, rhs, lhs.sign != rhs.sign);
+}
+
+// res -= lhs * rhs
+Integer &subMul(Integer &res, const Integer &lhs, const Integer &rhs) {
+  return res.addProduct(lhs, rhs, lhs.sign == rhs.sign);
+}
+
+// lhs * rhs + addend
+Integer mulAdd(const Integer &lhs, const Integer &rhs, const Integer &addend) {
+  Integer res = addend;
+  return addMul(res, lhs, rhs);
 }
 
 void Integer::fixZero() {
-  if (intVect.size() == 1 && intVect.front() == 0) {
+  if (getIntVect().size() == 1 && getIntVect().front() == 0) {
     sign = false;
   }
 }
 
-static IntVector toIntVector(const std::string &strVal, int64_t baseSize) {
-  IntVector intVect;
-  auto iter = strVal.end();
-  for (; distance(strVal.begin(), iter) > baseSize; iter -= baseSize) {
-    intVect.push_back(stoll(std::string(iter - baseSize, iter)));
+/*
+  If the product has the same sign as the number and one of the factors is short, the product is accumulated right in
+  the digits of the number. Otherwise the product is calculated separately and added, as well as when the number is one
+  of the factors, because its digits are changed while they are read.
+*/
+Integer &Integer::addProduct(const Integer &lhs, const Integer &rhs, bool isProductNegative) {
+  if (lhs == 0 || rhs == 0) {
+    return *this;
+  }
+
+  bool isZero = getIntVect().size() == 1 && getIntVect().front() == 0;
+  bool isFactor = &lhs == this || &rhs == this;
+  if (!isFactor && (isZero || isProductNegative == sign) &&
+      (lhs.getIntVect().size() < KARATSUBA_CUTOFF || rhs.getIntVect().size() < KARATSUBA_CUTOFF)) {
+    IntVector &resVect = getMutableIntVect();
+    polynomialMultiplyAdd(resVect, lhs.getIntVect(), rhs.getIntVect(), INT_BASE);
+    sign = isProductNegative;
+    return *this;
+  }
+
+  Integer product = lhs * rhs;
+  product.sign = isProductNegative;
+  return *this += product;
+}
+
+// Integers of up to 3 digits are compared in __int128 without allocations, the others are greater by magnitude
+int Integer::compare(const Integer &lhs, int64_t rhs) {
+  const size_t maxDigitsNum = 3;
+
+  IntSpan lhsVect = lhs.getIntVect();
+  if (lhsVect.size() > maxDigitsNum) {
+    return lhs.sign ? -1 : 1;
+  }
+
+  __int128 lhsVal = 0;
+  for (auto iter = lhsVect.rbegin(); iter != lhsVect.rend(); ++iter) {
+    lhsVal = lhsVal * INT_BASE + *iter;
+  }
+  if (lhs.sign) {
+    lhsVal = -lhsVal;
+  }
+  return lhsVal < rhs ? -1 : (lhsVal == rhs ? 0 : 1);
+}
+
+// Default Integers have no digits
+IntSpan Integer::getIntVect() const {
+  return intVect ? IntSpan(*intVect) : borrowedVect;
+}
+
+/*
+  The digits are copied only if they are shared. Other owners may have released them in other threads, the fence makes
+  their reads happen before the changes.
+*/
+IntVector &Integer::getMutableIntVect() {
+  if (!intVect || intVect.use_count() != 1) {
+    IntSpan val = getIntVect();
+    intVect = std::make_shared<IntVector>(val.begin(), val.end());
+    borrowedVect = {};
+    return *intVect;
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return *intVect;
+}
+
+// The allocated block is reused if it is not shared
+void Integer::setIntVect(IntVector &&val) {
+  if (!intVect || intVect.use_count() != 1) {
+    intVect = std::make_shared<IntVector>(std::move(val));
+    borrowedVect = {};
+    return;
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  *intVect = std::move(val);
+}
+
+// The digits are read in place, baseSize at a time from the end
+static IntVector toIntVector(std::string_view strVal, int64_t baseSize) {
+  const int64_t base = 10;
+
+  IntVector intVect((strVal.size() + baseSize - 1) / baseSize);
+  size_t end = strVal.size();
+  for (auto &digit : intVect) {
+    size_t begin = end > (size_t)baseSize ? end - baseSize : 0;
+    digit = 0;
+    for (size_t i = begin; i < end; i++) {
+      digit = digit * base + (strVal[i] - '0');
+    }
+    end = begin;
   }
-  intVect.push_back(stoll(std::string(strVal.begin(), iter)));
+
   toSignificantDigits(intVect);
   return intVect;
 }
 
-static bool canConvert(const std::string &strVal) {
+static bool canConvert(std::string_view strVal) {
   const int64_t firstDigit = 0;
   const int64_t lastDigit = 9;
-  return all_of(strVal.begin(), strVal.end(), [](auto ch) { return ch - '0' >= firstDigit && ch - '0' <= lastDigit; });
+  return std::all_of(strVal.begin(), strVal.end(), [](auto ch) { return ch - '0' >= firstDigit && ch - '0' <= lastDigit; });
 }
 
-static std::string toString(const IntVector &intVect, int64_t baseSize) {
-  std::string strVal = std::to_string(intVect.back());
-  if (intVect.size() == 1) {
-    return strVal;
-  }
+static std::string toString(IntSpan intVect, int64_t baseSize) {
+  std::string strVal((intVect.size() - 1) * baseSize + std::to_string(intVect.back()).size(), '0');
+  size_t pos = writeDigit(strVal.data(), intVect.back(), baseSize, false);
   for (size_t i = intVect.size() - 2; i != SIZE_MAX; i--) {
-    std::string tmp = std::to_string(intVect[i]);
-    tmp.insert(0, baseSize - tmp.size(), '0');
-    strVal.insert(strVal.size(), tmp);
+    pos += writeDigit(strVal.data() + pos, intVect[i], baseSize, true);
   }
   return strVal;
 }
 
+// Writing digits from high to low through a fixed size buffer
+static void toStream(std::ostream &out, IntSpan intVect, int64_t baseSize) {
+  char buff[STREAM_BUFFER_SIZE];
+  size_t pos = writeDigit(buff, intVect.back(), baseSize, false);
+  for (size_t i = intVect.size() - 2; i != SIZE_MAX; i--) {
+    if (pos + baseSize > STREAM_BUFFER_SIZE) {
+      out.write(buff, (std::streamsize)pos);
+      pos = 0;
+    }
+    pos += writeDigit(buff + pos, intVect[i], baseSize, true);
+  }
+  out.write(buff, (std::streamsize)pos);
+}
+
+// Writing one digit of the vector to the buffer, padded digits are written with leading zeros
+static size_t writeDigit(char *buff, int64_t digit, int64_t baseSize, bool isPadded) {
+  const int64_t base = 10;
+
+  size_t digitSize = 1;
+  if (isPadded) {
+    digitSize = baseSize;
+  } else {
+    for (int64_t tmp = digit / base; tmp != 0; tmp /= base) {
+      digitSize++;
+    }
+  }
+
+  for (size_t i = digitSize - 1; i != SIZE_MAX; i--) {
+    buff[i] = (char)('0' + digit % base);
+    digit /= base;
+  }
+  return digitSize;
+}
+
 // Finding a digit before the first non-zero digit, starting with the lowest digits
-static int64_t firstZeroNum(const IntVector &rhs) {
+static int64_t firstZeroNum(IntSpan rhs) {
   int64_t num = 0;
   while (num < rhs.size() && rhs[num] == 0) {
     num++;
@@ -493,7 +796,7 @@ static void toBaseNegative(IntVector &rhs, size_t pos, int64_t base) {
   }
 }
 
-static bool equal(const IntVector &lhs, const IntVector &rhs) {
+static bool equal(IntSpan lhs, IntSpan rhs) {
   if (lhs.size() != rhs.size()) {
     return false;
   }
@@ -507,7 +810,7 @@ static bool equal(const IntVector &lhs, const IntVector &rhs) {
   return true;
 }
 
-static bool less(const IntVector &lhs, const IntVector &rhs) {
+static bool less(IntSpan lhs, IntSpan rhs) {
   if (lhs.size() > rhs.size()) {
     return false;
   }
@@ -527,7 +830,7 @@ static bool less(const IntVector &lhs, const IntVector &rhs) {
   return false;
 }
 
-static bool greater(const IntVector &lhs, const IntVector &rhs) {
+static bool greater(IntSpan lhs, IntSpan rhs) {
   if (lhs.size() > rhs.size()) {
     return true;
   }
@@ -547,7 +850,7 @@ static bool greater(const IntVector &lhs, const IntVector &rhs) {
   return false;
 }
 
-static bool lessEqual(const IntVector &lhs, const IntVector &rhs) {
+static bool lessEqual(IntSpan lhs, IntSpan rhs) {
   if (lhs.size() > rhs.size()) {
     return false;
   }
@@ -567,7 +870,7 @@ static bool lessEqual(const IntVector &lhs, const IntVector &rhs) {
   return true;
 }
 
-static bool greaterEqual(const IntVector &lhs, const IntVector &rhs) {
+static bool greaterEqual(IntSpan lhs, IntSpan rhs) {
   if (lhs.size() > rhs.size()) {
     return true;
   }
@@ -588,8 +891,8 @@ static bool greaterEqual(const IntVector &lhs, const IntVector &rhs) {
 }
 
 // Column addition without reduction to significant digits
-static IntVector add(const IntVector &lhs, const IntVector &rhs, int64_t base) {
-  IntVector val = lhs;
+static IntVector add(IntSpan lhs, IntSpan rhs, int64_t base) {
+  IntVector val(lhs.begin(), lhs.end());
   if (rhs.size() > val.size()) {
     val.resize(rhs.size(), 0);
   }
@@ -607,15 +910,15 @@ static IntVector add(const IntVector &lhs, const IntVector &rhs, int64_t base) {
 }
 
 // Column addition with reduction to significant digits
-static IntVector addToSignificantDigits(const IntVector &lhs, const IntVector &rhs, int64_t base) {
+static IntVector addToSignificantDigits(IntSpan lhs, IntSpan rhs, int64_t base) {
   IntVector val = add(lhs, rhs, base);
   toSignificantDigits(val);
   return val;
 }
 
 // Column substraction
-static IntVector substract(const IntVector &lhs, const IntVector &rhs, int64_t base) {
-  IntVector val = lhs;
+static IntVector substract(IntSpan lhs, IntSpan rhs, int64_t base) {
+  IntVector val(lhs.begin(), lhs.end());
 
   for (size_t i = 0; i < rhs.size(); i++) {
     val[i] -= rhs[i];
@@ -630,14 +933,17 @@ static IntVector substract(const IntVector &lhs, const IntVector &rhs, int64_t b
 }
 
 // Multiplication by a short number
-static IntVector shortMultiply(const IntVector &lhs, int64_t rhs, int64_t base) {
+static IntVector shortMultiply(IntSpan lhs, int64_t rhs, int64_t base) {
   IntVector val;
   val.resize(lhs.size() + 1, 0);
 
+  int64_t carry = 0;
   for (size_t i = 0; i < lhs.size(); i++) {
-    val[i] += lhs[i] * rhs;
-    toBasePositive(val, i, base);
+    int64_t product = lhs[i] * rhs + carry;
+    carry = product / base;
+    val[i] = product % base;
   }
+  val.back() = carry;
 
   toSignificantDigits(val);
   return val;
@@ -646,7 +952,7 @@ static IntVector shortMultiply(const IntVector &lhs, int64_t rhs, int64_t base)
 /*
   Multiplication of numbers in the form of polynomials without reduction to significant digits
 */
-static IntVector polynomialMultiply(const IntVector &lhs, const IntVector &rhs, int64_t base) {
+static IntVector polynomialMultiply(IntSpan lhs, IntSpan rhs, int64_t base) {
   IntVector res;
   res.resize(lhs.size() + rhs.size(), 0);
 
@@ -660,6 +966,26 @@ static IntVector polynomialMultiply(const IntVector &lhs, const IntVector &rhs,
   return res;
 }
 
+/*
+  Multiplication of numbers in the form of polynomials with adding the product to res, the result is reduced to
+  significant digits
+*/
+static void polynomialMultiplyAdd(IntVector &res, IntSpan lhs, IntSpan rhs, int64_t base) {
+  res.resize(std::max(res.size(), lhs.size() + rhs.size()) + 1, 0);
+
+  for (size_t i = 0; i < lhs.size(); i++) {
+    for (size_t j = 0; j < rhs.size(); j++) {
+      res[i + j] += lhs[i] * rhs[j];
+      toBasePositive(res, i + j, base);
+    }
+  }
+  for (size_t i = lhs.size() + rhs.size() - 1; i < res.size() - 1; i++) {
+    toBasePositive(res, i, base);
+  }
+
+  toSignificantDigits(res);
+}
+
 /*
   Multiplication of numbers A by B by Karatsuba's method. Recursively applied until the size of of one of the numbers is
   equal to KARATSUBA_CUTOFF
@@ -673,18 +999,18 @@ static IntVector polynomialMultiply(const IntVector &lhs, const IntVector &rhs,
   A0 и B0 - the first halves of numbers
   A1 и B1 - the second halves of numbers
 */
-static IntVector karatsubaMultiply(const IntVector &lhs, const IntVector &rhs, int64_t base) {
+static IntVector karatsubaMultiply(IntSpan lhs, IntSpan rhs, int64_t base) {
   if (lhs.size() < KARATSUBA_CUTOFF || rhs.size() < KARATSUBA_CUTOFF) {
     return polynomialMultiply(lhs, rhs, base);
   }
 
   int64_t mid = (int64_t)lhs.size() / 2;
 
-  IntVector lhsHalf1(lhs.begin(), lhs.begin() + mid);
-  IntVector lhsHalf2(lhs.begin() + mid, lhs.end());
+  IntSpan lhsHalf1(lhs.data(), mid);
+  IntSpan lhsHalf2(lhs.data() + mid, lhs.size() - mid);
 
-  IntVector rhsHalf1(rhs.begin(), rhs.begin() + mid);
-  IntVector rhsHalf2(rhs.begin() + mid, rhs.end());
+  IntSpan rhsHalf1(rhs.data(), mid);
+  IntSpan rhsHalf2(rhs.data() + mid, rhs.size() - mid);
 
   IntVector coeff1 = karatsubaMultiply(lhsHalf1, rhsHalf1, base);
   IntVector coeff2 = karatsubaMultiply(add(lhsHalf1, lhsHalf2, base), add(rhsHalf1, rhsHalf2, base), base);
@@ -698,38 +1024,208 @@ static IntVector karatsubaMultiply(const IntVector &lhs, const IntVector &rhs, i
   return add(add(coeff3, coeff2, base), coeff1, base);
 }
 
+/*
+  Multiplication of large numbers using the number theoretic transform modulo the prime
+  NTT_MOD = 29 * 2^57 + 1 with the primitive root 3.
+
+  Every INT_BASE digit is split into NTT_DIGITS_IN_BASE digits of NTT_BASE, so the convolution coefficients never exceed
+  NTT_BASE^2 * size < NTT_MOD. Modular multiplication uses Montgomery reduction with R = 2^64: the data stays in the
+  normal form and only the roots are kept in the Montgomery form, so montMultiply(val, root) is a plain product.
+  The buffers are released as soon as possible, as they are several times larger than the numbers.
+*/
+static IntVector nttMultiply(IntSpan lhs, IntSpan rhs) {
+  size_t resSize = (lhs.size() + rhs.size()) * NTT_DIGITS_IN_BASE;
+  size_t size = 1;
+  while (size < resSize) {
+    size *= 2;
+  }
+
+  NttVector lhsVect = toNttVector(lhs, size);
+  {
+    NttVector rhsVect = toNttVector(rhs, size);
+    NttVector roots = getNttRoots(size, false);
+    ntt(lhsVect, roots);
+    ntt(rhsVect, roots);
+
+    uint64_t rSqr = toMont(toMont(1));
+    for (size_t i = 0; i < size; i++) {
+      lhsVect[i] = montMultiply(montMultiply(lhsVect[i], rhsVect[i]), rSqr);
+    }
+  }
+
+  inverseNtt(lhsVect, getNttRoots(size, true));
+
+  uint64_t sizeInversed = toMont(powMod(size, NTT_MOD - 2));
+  IntVector val(lhs.size() + rhs.size(), 0);
+  uint64_t carry = 0;
+  int64_t digitMultiplier = 1;
+
+  for (size_t i = 0; i < resSize; i++) {
+    uint64_t coeff = montMultiply(lhsVect[i], sizeInversed) + carry;
+    val[i / NTT_DIGITS_IN_BASE] += (int64_t)(coeff % NTT_BASE) * digitMultiplier;
+    carry = coeff / NTT_BASE;
+    digitMultiplier = (i + 1) % NTT_DIGITS_IN_BASE == 0 ? 1 : digitMultiplier * NTT_BASE;
+  }
+
+  toSignificantDigits(val);
+  return val;
+}
+
+static uint64_t montReduce(NttWord val) {
+  auto coeff = (uint64_t)val * NTT_MOD_INVERSED;
+  auto res = (uint64_t)((val + (NttWord)coeff * NTT_MOD) >> 64);
+  return res >= NTT_MOD ? res - NTT_MOD : res;
+}
+
+static uint64_t montMultiply(uint64_t lhs, uint64_t rhs) {
+  return montReduce((NttWord)lhs * rhs);
+}
+
+// Converting to the Montgomery form
+static uint64_t toMont(uint64_t val) {
+  return (uint64_t)(((NttWord)val << 64) % NTT_MOD);
+}
+
+static uint64_t powMod(uint64_t lhs, uint64_t rhs) {
+  uint64_t res = 1;
+  while (rhs != 0) {
+    if (rhs % 2 == 1) {
+      res = (uint64_t)((NttWord)res * lhs % NTT_MOD);
+    }
+    lhs = (uint64_t)((NttWord)lhs * lhs % NTT_MOD);
+    rhs /= 2;
+  }
+  return res;
+}
+
+/*
+  Roots of unity for all the butterfly levels are stored in one table: roots[len + j] = w_(2len)^j in the Montgomery
+  form. Each pass over the data reads its roots sequentially.
+*/
+static NttVector getNttRoots(size_t size, bool isInversed) {
+  NttVector roots(size);
+  for (size_t len = 1; len < size; len *= 2) {
+    uint64_t root = powMod(NTT_ROOT, (NTT_MOD - 1) / (len * 2));
+    if (isInversed) {
+      root = powMod(root, NTT_MOD - 2);
+    }
+    uint64_t rootMont = toMont(root);
+    uint64_t val = toMont(1);
+    for (size_t j = 0; j < len; j++) {
+      roots[len + j] = val;
+      val = montMultiply(val, rootMont);
+    }
+  }
+  return roots;
+}
+
+/*
+  The forward transform is decimation in frequency, it leaves the values in the bit-reversed order. The inverse one is
+  decimation in time, it takes them in this order back, so the data is never permuted. Every pass walks two sequential
+  streams. The levels of less than NTT_BLOCK_SIZE values are done block by block in a single pass over the data, which
+  keeps a block in the cache, or in the memory when the data is mapped from the disk.
+*/
+static void ntt(NttVector &vect, const NttVector &roots) {
+  size_t size = vect.size();
+  size_t blockSize = std::min(size, NTT_BLOCK_SIZE);
+
+  for (size_t len = size / 2; len >= blockSize; len /= 2) {
+    nttPass(vect.data(), size, len, roots);
+  }
+  for (size_t i = 0; i < size; i += blockSize) {
+    for (size_t len = blockSize / 2; len != 0; len /= 2) {
+      nttPass(vect.data() + i, blockSize, len, roots);
+    }
+  }
+}
+
+static void inverseNtt(NttVector &vect, const NttVector &roots) {
+  size_t size = vect.size();
+  size_t blockSize = std::min(size, NTT_BLOCK_SIZE);
+
+  for (size_t i = 0; i < size; i += blockSize) {
+    for (size_t len = 1; len < blockSize; len *= 2) {
+      inverseNttPass(vect.data() + i, blockSize, len, roots);
+    }
+  }
+  for (size_t len = blockSize; len < size; len *= 2) {
+    inverseNttPass(vect.data(), size, len, roots);
+  }
+}
+
+static void nttPass(uint64_t *vect, size_t size, size_t len, const NttVector &roots) {
+  for (size_t i = 0; i < size; i += len * 2) {
+    for (size_t j = 0; j < len; j++) {
+      uint64_t lhs = vect[i + j];
+      uint64_t rhs = vect[i + j + len];
+      vect[i + j] = lhs + rhs >= NTT_MOD ? lhs + rhs - NTT_MOD : lhs + rhs;
+      vect[i + j + len] = montMultiply(lhs >= rhs ? lhs - rhs : lhs + NTT_MOD - rhs, roots[len + j]);
+    }
+  }
+}
+
+static void inverseNttPass(uint64_t *vect, size_t size, size_t len, const NttVector &roots) {
+  for (size_t i = 0; i < size; i += len * 2) {
+    for (size_t j = 0; j < len; j++) {
+      uint64_t lhs = vect[i + j];
+      uint64_t rhs = montMultiply(vect[i + j + len], roots[len + j]);
+      vect[i + j] = lhs + rhs >= NTT_MOD ? lhs + rhs - NTT_MOD : lhs + rhs;
+      vect[i + j + len] = lhs >= rhs ? lhs - rhs : lhs + NTT_MOD - rhs;
+    }
+  }
+}
+
+static NttVector toNttVector(IntSpan rhs, size_t size) {
+  NttVector vect(size, 0);
+  for (size_t i = 0; i < rhs.size(); i++) {
+    int64_t digit = rhs[i];
+    for (size_t j = 0; j < NTT_DIGITS_IN_BASE; j++) {
+      vect[i * NTT_DIGITS_IN_BASE + j] = digit % NTT_BASE;
+      digit /= NTT_BASE;
+    }
+  }
+  return vect;
+}
+
 // Multiplication of zero digits
-static size_t zerosMultiply(IntVector &lhs, IntVector &rhs) {
+static size_t zerosMultiply(IntSpan &lhs, IntSpan &rhs) {
   int64_t lhsZerosNum = firstZeroNum(lhs);
   int64_t rhsZerosNum = firstZeroNum(rhs);
 
   if (lhs.size() != 1) {
-    lhs.erase(lhs.begin(), lhs.begin() + lhsZerosNum);
+    lhs = IntSpan(lhs.data() + lhsZerosNum, lhs.size() - lhsZerosNum);
   }
   if (rhs.size() != 1) {
-    rhs.erase(rhs.begin(), rhs.begin() + rhsZerosNum);
+    rhs = IntSpan(rhs.data() + rhsZerosNum, rhs.size() - rhsZerosNum);
   }
 
   return lhsZerosNum + rhsZerosNum;
 }
 
-// Adding leading zeros to bring the numbers to the required form
-static IntVector multiply(const IntVector &lhs, const IntVector &rhs, int64_t base) {
-  IntVector tmpLhs = lhs;
-  IntVector tmpRhs = rhs;
-  size_t zerosNum = zerosMultiply(tmpLhs, tmpRhs);
+// Adding leading zeros to bring the numbers to the required form, the operands are copied only for Karatsuba's method
+static IntVector multiply(IntSpan lhs, IntSpan rhs, int64_t base) {
+  size_t zerosNum = zerosMultiply(lhs, rhs);
 
-  if (tmpLhs.size() < KARATSUBA_CUTOFF || tmpRhs.size() < KARATSUBA_CUTOFF) {
-    IntVector val = polynomialMultiply(tmpLhs, tmpRhs, base);
+  if (lhs.size() < KARATSUBA_CUTOFF || rhs.size() < KARATSUBA_CUTOFF) {
+    IntVector val = polynomialMultiply(lhs, rhs, base);
     val.insert(val.begin(), zerosNum, 0);
     toSignificantDigits(val);
     return val;
   }
 
-  size_t maxSize = std::max(tmpLhs.size(), tmpRhs.size());
+  if (base == INT_BASE && lhs.size() >= NTT_CUTOFF && rhs.size() >= NTT_CUTOFF) {
+    IntVector val = nttMultiply(lhs, rhs);
+    val.insert(val.begin(), zerosNum, 0);
+    toSignificantDigits(val);
+    return val;
+  }
+
+  size_t maxSize = std::max(lhs.size(), rhs.size());
   if (maxSize % 2 == 1) {
     maxSize++;
   }
+  IntVector tmpLhs(lhs.begin(), lhs.end());
+  IntVector tmpRhs(rhs.begin(), rhs.end());
   tmpLhs.resize(maxSize, 0);
   tmpRhs.resize(maxSize, 0);
 
@@ -741,8 +1237,8 @@ static IntVector multiply(const IntVector &lhs, const IntVector &rhs, int64_t ba
 }
 
 // Dividing by a short number
-static IntVector shortDivide(const IntVector &lhs, int64_t rhs, int64_t base) {
-  IntVector val = lhs;
+static IntVector shortDivide(IntSpan lhs, int64_t rhs, int64_t base) {
+  IntVector val(lhs.begin(), lhs.end());
 
   for (size_t i = val.size() - 1; i > 0; i--) {
     val[i - 1] += (val[i] % rhs) * base;
@@ -755,8 +1251,8 @@ static IntVector shortDivide(const IntVector &lhs, int64_t rhs, int64_t base) {
 }
 
 // Dividing by short number with a remainder
-static IntVector shortDivide(const IntVector &lhs, int64_t rhs, IntVector &modVal, int64_t base) {
-  IntVector val = lhs;
+static IntVector shortDivide(IntSpan lhs, int64_t rhs, IntVector &modVal, int64_t base) {
+  IntVector val(lhs.begin(), lhs.end());
 
   for (size_t i = val.size() - 1; i > 0; i--) {
     val[i - 1] += (val[i] % rhs) * base;
@@ -778,65 +1274,236 @@ static void zerosDivide(IntVector &lhs, IntVector &rhs) {
   }
 }
 
-static IntVector binsearchDivide(const IntVector &lhs, const IntVector &rhs, IntVector &left, IntVector &right,
-                                 int64_t base) {
-  IntVector mid;
-  while (::greater(substract(right, left, base), IntVector{1})) {
-    mid = shortDivide(addToSignificantDigits(left, right, base), 2, base);
-    IntVector multVal = multiply(rhs, mid, base);
-    if (::greater(multVal, lhs)) {
-      right = mid;
-    } else {
-      left = mid;
+/*
+  Knuth's long division. A and B are first multiplied by base / (B.back() + 1), so that B.back() >= base / 2. Then each
+  digit of the quotient is estimated from the highest digits of the remainder and B, the estimation exceeds the real
+  digit by at most 2 and is corrected by adding B back to the remainder.
+*/
+static IntVector longDivide(IntSpan lhs, IntSpan rhs, IntVector &modVal, int64_t base) {
+  int64_t normMultiplier = base / (rhs.back() + 1);
+  IntVector tmpLhs = shortMultiply(lhs, normMultiplier, base);
+  IntVector tmpRhs = shortMultiply(rhs, normMultiplier, base);
+  tmpLhs.resize(lhs.size() + 1, 0);
+
+  size_t rhsSize = tmpRhs.size();
+  size_t valSize = lhs.size() - rhsSize + 1;
+  int64_t rhsFirst = tmpRhs[rhsSize - 1];
+  int64_t rhsSecond = tmpRhs[rhsSize - 2];
+
+  IntVector val(valSize, 0);
+
+  for (size_t i = valSize - 1; i != SIZE_MAX; i--) {
+    int64_t highDigits = tmpLhs[i + rhsSize] * base + tmpLhs[i + rhsSize - 1];
+    int64_t digit = highDigits / rhsFirst;
+    int64_t digitMod = highDigits % rhsFirst;
+
+    while (digit >= base || digit * rhsSecond > digitMod * base + tmpLhs[i + rhsSize - 2]) {
+      digit--;
+      digitMod += rhsFirst;
+      if (digitMod >= base) {
+        break;
+      }
+    }
+
+    int64_t carry = 0;
+    int64_t borrow = 0;
+    for (size_t j = 0; j < rhsSize; j++) {
+      int64_t product = digit * tmpRhs[j] + carry;
+      carry = product / base;
+      int64_t diff = tmpLhs[i + j] - product % base - borrow;
+      borrow = diff < 0 ? 1 : 0;
+      tmpLhs[i + j] = diff + borrow * base;
+    }
+    int64_t highDiff = tmpLhs[i + rhsSize] - carry - borrow;
+
+    if (highDiff < 0) {
+      digit--;
+      carry = 0;
+      for (size_t j = 0; j < rhsSize; j++) {
+        int64_t sum = tmpLhs[i + j] + tmpRhs[j] + carry;
+        carry = sum >= base ? 1 : 0;
+        tmpLhs[i + j] = sum - carry * base;
+      }
+      highDiff += carry;
     }
+
+    tmpLhs[i + rhsSize] = highDiff;
+    val[i] = digit;
   }
 
-  IntVector val;
-  IntVector multVal = multiply(rhs, right, base);
-  if (::greater(lhs, multVal) || equal(lhs, multVal)) {
-    val = right;
+  tmpLhs.resize(rhsSize);
+  toSignificantDigits(tmpLhs);
+  modVal = shortDivide(tmpLhs, normMultiplier, base);
+
+  toSignificantDigits(val);
+  return val;
+}
+
+static IntVector divide(IntSpan lhs, IntSpan rhs, IntVector &modVal, int64_t base) {
+  if (rhs.size() == 1) {
+    return shortDivide(lhs, rhs.front(), modVal, base);
+  }
+  if (::greater(rhs, lhs)) {
+    modVal.assign(lhs.begin(), lhs.end());
+    return IntVector{0};
+  }
+
+  // a / (b * base^k) = (a / base^k) / b, the lower k digits of a are prepended to the remainder
+  if (auto zerosNum = (size_t)firstZeroNum(rhs); zerosNum != 0) {
+    IntVector val = divide(shiftRight(lhs, zerosNum), shiftRight(rhs, zerosNum), modVal, base);
+    modVal.insert(modVal.begin(), lhs.begin(), lhs.begin() + (int64_t)zerosNum);
+    toSignificantDigits(modVal);
+    return val;
+  }
+
+  if (rhs.size() >= NEWTON_DIVIDE_CUTOFF && lhs.size() - rhs.size() >= NEWTON_DIVIDE_CUTOFF) {
+    return newtonDivide(lhs, rhs, modVal, base);
+  }
+  return longDivide(lhs, rhs, modVal, base);
+}
+
+// Division by base^digitsNum
+static IntVector shiftRight(IntSpan rhs, size_t digitsNum) {
+  if (digitsNum >= rhs.size()) {
+    return IntVector{0};
+  }
+  return IntVector(rhs.begin() + (int64_t)digitsNum, rhs.end());
+}
+
+/*
+  base^(2n) / B for B of n digits with an error of a few units of base. The reciprocal X of the highest n/2 + 1 digits
+  is refined by one Newton's step: X' = X + X * (base^(2n) - B*X) / base^(2n).
+*/
+static IntVector reciprocal(IntSpan rhs, int64_t base) {
+  size_t size = rhs.size();
+  IntVector powVal(size * 2 + 1, 0);
+  powVal.back() = 1;
+
+  if (size <= NEWTON_RECIPROCAL_CUTOFF) {
+    IntVector modVal;
+    return longDivide(powVal, rhs, modVal, base);
+  }
+
+  size_t shift = size - (size / 2 + 1);
+  IntVector val = reciprocal(shiftRight(rhs, shift), base);
+  val.insert(val.begin(), shift, 0);
+
+  IntVector product = multiply(rhs, val, base);
+  if (::greater(product, powVal)) {
+    IntVector correction = shiftRight(multiply(val, substract(product, powVal, base), base), size * 2);
+    return substract(val, addToSignificantDigits(correction, IntVector{1}, base), base);
+  }
+  IntVector correction = shiftRight(multiply(val, substract(powVal, product, base), base), size * 2);
+  return addToSignificantDigits(val, correction, base);
+}
+
+/*
+  Division by the reciprocal of B taken with Q.size() + 2 digits, B and A are truncated or padded with zeros to that
+  size. The estimated quotient differs from the real one by a few units, it is corrected by comparing Q*B with A.
+*/
+static IntVector newtonDivide(IntSpan lhs, IntSpan rhs, IntVector &modVal, int64_t base) {
+  size_t divisorSize = lhs.size() - rhs.size() + 3;
+  IntVector tmpLhs;
+  IntVector tmpRhs;
+  if (divisorSize <= rhs.size()) {
+    tmpLhs = shiftRight(lhs, rhs.size() - divisorSize);
+    tmpRhs = shiftRight(rhs, rhs.size() - divisorSize);
   } else {
-    val = left;
+    tmpLhs.assign(lhs.begin(), lhs.end());
+    tmpRhs.assign(rhs.begin(), rhs.end());
+    tmpLhs.insert(tmpLhs.begin(), divisorSize - rhs.size(), 0);
+    tmpRhs.insert(tmpRhs.begin(), divisorSize - rhs.size(), 0);
   }
 
+  IntVector val = shiftRight(multiply(tmpLhs, reciprocal(tmpRhs, base), base), divisorSize * 2);
+
+  IntVector product = multiply(val, rhs, base);
+  while (::greater(product, lhs)) {
+    val = substract(val, IntVector{1}, base);
+    product = substract(product, rhs, base);
+  }
+  modVal = substract(lhs, product, base);
+  while (!::greater(rhs, modVal)) {
+    val = addToSignificantDigits(val, IntVector{1}, base);
+    modVal = substract(modVal, rhs, base);
+  }
   return val;
 }
 
 /*
-  The lower and upper bounds for binsearch division are defined as follows: N = A/(B.back() +- 1). N is the
-  corresponding bound of B.back() - the most significant digit of B. Then (N.size() + B.size()) of the first digits
-  are discarded.
+  Jebelean's exact division, the quotient digits are found from the lowest one: q_i = A_i * B_0^(-1) mod base, then
+  q_i * B is substracted from A. Only the lowest Q.size() digits of A are ever needed.
+
+  B_0 has to be invertible modulo base = 2^9 * 5^9, so low zero digits and factors 2 and 5 of B_0 are first divided
+  out of both numbers.
 */
-static IntVector divide(const IntVector &lhs, const IntVector &rhs, IntVector &modVal, int64_t base) {
-  if (rhs.size() == 1) {
-    return shortDivide(lhs, rhs.front(), modVal, base);
-  }
+static IntVector exactDivide(IntSpan lhs, IntSpan rhs, int64_t base) {
+  const int64_t maxPowOf2 = 512;
+  const int64_t maxPowOf5 = 1953125;
 
-  IntVector tmpLhs = lhs;
-  IntVector tmpRhs = rhs;
+  IntVector tmpLhs(lhs.begin(), lhs.end());
+  IntVector tmpRhs(rhs.begin(), rhs.end());
   zerosDivide(tmpLhs, tmpRhs);
 
-  IntVector left;
-  IntVector right;
-  left = shortDivide(tmpLhs, tmpRhs.back() + 1, base);
+  while (tmpRhs.front() % 2 == 0 || tmpRhs.front() % 5 == 0) {
+    int64_t multiplier = 1;
+    for (int64_t digit = tmpRhs.front(); digit % 2 == 0 && multiplier < maxPowOf2; digit /= 2) {
+      multiplier *= 2;
+    }
+    for (int64_t digit = tmpRhs.front(), pow5 = 1; digit % 5 == 0 && pow5 < maxPowOf5; digit /= 5) {
+      multiplier *= 5;
+      pow5 *= 5;
+    }
+    tmpLhs = shortDivide(tmpLhs, multiplier, base);
+    tmpRhs = shortDivide(tmpRhs, multiplier, base);
+  }
 
-  if (tmpRhs.back() != 1) {
-    right = shortDivide(tmpLhs, tmpRhs.back() - 1, base);
-  } else {
-    right = tmpLhs;
-    right.back() = INT_BASE - 1;
+  if (tmpRhs.size() > tmpLhs.size()) {
+    return IntVector{0};
   }
 
-  left.erase(left.begin(), left.begin() + (int64_t)tmpRhs.size() - 1);
-  right.erase(right.begin(), right.begin() + (int64_t)tmpRhs.size() - 1);
+  size_t valSize = tmpLhs.size() - tmpRhs.size() + 1;
+  int64_t inversedRhs = inverseModBase(tmpRhs.front(), base);
+  IntVector val(valSize, 0);
+
+  for (size_t i = 0; i < valSize; i++) {
+    int64_t digit = tmpLhs[i] * inversedRhs % base;
+    val[i] = digit;
 
-  if (equal(right, left)) {
-    modVal = substract(lhs, multiply(rhs, left, base), base);
-    return left;
+    int64_t borrow = 0;
+    for (size_t j = 0; j < tmpRhs.size() && i + j < valSize; j++) {
+      int64_t diff = tmpLhs[i + j] - borrow - digit * tmpRhs[j];
+      borrow = 0;
+      if (diff < 0) {
+        borrow = (base - 1 - diff) / base;
+        diff += borrow * base;
+      }
+      tmpLhs[i + j] = diff;
+    }
+    for (size_t j = i + tmpRhs.size(); j < valSize && borrow != 0; j++) {
+      tmpLhs[j] -= borrow;
+      borrow = 0;
+      if (tmpLhs[j] < 0) {
+        tmpLhs[j] += base;
+        borrow = 1;
+      }
+    }
   }
 
-  IntVector val = binsearchDivide(tmpLhs, tmpRhs, left, right, base);
-  modVal = substract(lhs, multiply(rhs, val, base), base);
+  toSignificantDigits(val);
+  return val;
+}
+
+// Inverse element modulo base by Newton's iteration x = x * (2 - a * x), the number of correct digits doubles each step
+static int64_t inverseModBase(int64_t rhs, int64_t base) {
+  const int64_t decimalBase = 10;
+  const int64_t inversesMod10[] = {0, 1, 0, 7, 0, 0, 0, 3, 0, 9};
+
+  int64_t val = inversesMod10[rhs % decimalBase];
+  for (int64_t correctBase = decimalBase; correctBase < base; correctBase *= correctBase) {
+    int64_t mult = (2 + base - rhs * val % base) % base;
+    val = val * mult % base;
+  }
   return val;
 }
 
@@ -857,7 +1524,7 @@ static IntVector divide(const IntVector &lhs, const IntVector &rhs, IntVector &m
 
   5.To the resulting difference carry the next facet and follow the algorithm.
 */
-static IntVector sqrt(const IntVector &rhs) {
+static IntVector sqrt(IntSpan rhs) {
   const int64_t base = 10;
 
   IntVector val;
@@ -902,7 +1569,7 @@ static IntVector sqrt(const IntVector &rhs) {
   return val;
 }
 
-static void getSqrtDiff(const IntVector &rhs, const int64_t &base, IntVector &val, IntVector &diff) {
+static void getSqrtDiff(IntSpan rhs, const int64_t &base, IntVector &val, IntVector &diff) {
   int64_t tmpVal = rhs.back() - val.front() * val.front();
   diff.push_back(tmpVal % base);
   if (tmpVal >= base) {
@@ -4,18 +4,29 @@
 #include <cstddef>
 #include <cstdint>
 #include <iosfwd>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "single_entities/ISingleEntity.hpp"
+#include "single_entities/terms/numbers/IntSpan.hpp"
+#include "single_entities/terms/numbers/SpillAllocator.hpp"
 
 class Integer : public ISingleEntity {
 public:
   Integer() = default;
-  explicit Integer(const std::string &strVal);
+  explicit Integer(std::string_view strVal);
   // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
   Integer(int64_t val);
 
+  // A copy of a borrowing Integer owns its digits
+  Integer(const Integer &rhs);
+  Integer(Integer &&rhs) noexcept = default;
+  Integer &operator=(const Integer &rhs);
+  Integer &operator=(Integer &&rhs) noexcept = default;
+  ~Integer() override = default;
+
   Integer &operator=(int64_t rhs);
 
   Integer &operator+=(const Integer &rhs);
@@ -48,6 +59,8 @@ public:
   Integer operator%(int64_t rhs) const;
   friend Integer operator%(int64_t lhs, const Integer &rhs);
 
+  Integer &divExact(const Integer &rhs);
+
   Integer &operator++();
   Integer operator++(int);
 
@@ -85,16 +98,48 @@ public:
   friend std::ostream &operator<<(std::ostream &out, const Integer &rhs);
 
   size_t size() const;
+  // Integers of up to 18 digits, std::out_of_range is thrown for longer ones
+  int64_t toInt64() const;
+
+  // 10^rhs, the powers of up to 1000 digits are built once and shared between threads
+  static Integer pow10(size_t rhs);
+
+  /*
+    Digits and multiplication buffers of at least minSize bytes are kept in memory-mapped files of the directory, see
+    SpillAllocator. An empty directory keeps them in memory again.
+  */
+  static void setSpillDirectory(const std::string &directory, size_t minSize);
+
   std::string toString() const override;
   std::string getTypeName() const override;
 
   friend Integer sqrt(const Integer &);
 
+  friend Integer &addMul(Integer &res, const Integer &lhs, const Integer &rhs);
+  friend Integer &subMul(Integer &res, const Integer &lhs, const Integer &rhs);
+  friend Integer mulAdd(const Integer &lhs, const Integer &rhs, const Integer &addend);
+
+  friend class Rational;
+
 private:
-  std::vector<int64_t> intVect;
+  std::shared_ptr<std::vector<int64_t, SpillAllocator<int64_t>>> intVect;
+  // The digits are read in place from the storage of another number while intVect is not set
+  IntSpan borrowedVect;
   bool sign{};
 
+  /*
+    A non-negative Integer with the given digits. If isBorrowed is set, they are read in place, so they have to outlive
+    the Integer and its moves. Any change of the Integer or a copy of it gets its own digits.
+  */
+  Integer(IntSpan digits, bool isBorrowed);
+
+  IntSpan getIntVect() const;
+  std::vector<int64_t, SpillAllocator<int64_t>> &getMutableIntVect();
+  void setIntVect(std::vector<int64_t, SpillAllocator<int64_t>> &&val);
   void fixZero();
+  static int compare(const Integer &lhs, int64_t rhs);
+
+  Integer &addProduct(const Integer &lhs, const Integer &rhs, bool isProductNegative);
 };
 
 #endif // INTEGER_HPP
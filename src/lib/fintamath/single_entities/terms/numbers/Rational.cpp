@@ -4,71 +4,157 @@
 #include "single_entities/terms/numbers/Rational.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <iterator>
+#include <new>
+#include <numeric>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 
+#include "single_entities/terms/numbers/IntSpan.hpp"
+#include "single_entities/terms/numbers/SpillAllocator.hpp"
+
 constexpr int64_t INITIAL_PRECISION = 36;
 
+// Integers of up to this number of digits fit in int64_t
+constexpr size_t SMALL_SIZE = 18;
+
 static Integer gcd(const Integer &lhs, const Integer &rhs);
-static Integer lcm(const Integer &lhs, const Integer &rhs);
+static Integer toInteger(unsigned __int128 rhs);
+static bool isDigits(std::string_view strVal);
+static bool toUint64(std::string_view strVal, uint64_t &val);
+static uint64_t pow10Small(size_t rhs);
+static uint64_t getPow2Or5Gcd(uint64_t val, size_t power);
+static void reducePow10(Integer &numerator, Integer &denominator, size_t power);
+static Rational getSimplest(const Rational &lhs, const Rational &rhs);
 
-Rational::Rational(const std::string &strVal) {
-  if (strVal.empty()) {
-    throw std::invalid_argument("Rational invalid input");
+/*
+  The header of the block of a big Rational, the digits of the numerator and then of the denominator follow it. The
+  block is shared between copies and is released by the last of them.
+*/
+struct Rational::BigBlock {
+  std::atomic<size_t> refsNum;
+  size_t capacity;
+  size_t numeratorSize = 0;
+  size_t denominatorSize = 0;
+
+  explicit BigBlock(size_t capacity_) : refsNum(1), capacity(capacity_) {
+  }
+
+  int64_t *getDigits() {
+    return reinterpret_cast<int64_t *>(this + 1);
   }
 
-  size_t firstDigitNum = 0;
-  size_t firstDotNum = distance(strVal.begin(), find(strVal.begin(), strVal.end(), '.'));
+  const int64_t *getDigits() const {
+    return reinterpret_cast<const int64_t *>(this + 1);
+  }
 
+  IntSpan getNumerator() const {
+    return {getDigits(), numeratorSize};
+  }
+
+  IntSpan getDenominator() const {
+    return {getDigits() + numeratorSize, denominatorSize};
+  }
+
+  bool isUnique() const;
+  bool contains(const int64_t *ptr) const;
+};
+
+/*
+  The literal is read in one pass. Trailing zeros of the fractional part are dropped, then the fraction digits / 10^n
+  can only be reduced by powers of 2 or 5, which are found by small divisions instead of the gcd.
+*/
+Rational::Rational(std::string_view strVal) {
   bool isNegative = false;
-  if (strVal.front() == '-') {
+  if (!strVal.empty() && strVal.front() == '-') {
     isNegative = true;
-    firstDigitNum++;
+    strVal.remove_prefix(1);
   }
 
-  Integer intPart;
-  try {
-    intPart = Integer(strVal.substr(firstDigitNum, firstDotNum - firstDigitNum));
-  } catch (const std::invalid_argument &) {
+  size_t dotPos = strVal.find('.');
+  std::string_view intStr = strVal.substr(0, dotPos);
+  std::string_view fracStr = dotPos == std::string_view::npos ? std::string_view() : strVal.substr(dotPos + 1);
+  if (intStr.empty() || (dotPos != std::string_view::npos && fracStr.empty()) || !isDigits(intStr) ||
+      !isDigits(fracStr)) {
     throw std::invalid_argument("Rational invalid input");
   }
-
-  if (firstDotNum != strVal.size()) {
-    try {
-      std::string numeratorStr = strVal.substr(firstDotNum + 1);
-      std::string denominatorStr(numeratorStr.size() + 1, '0');
-      denominatorStr.front() = '1';
-      numerator = Integer(numeratorStr);
-      denominator = Integer(denominatorStr);
-    } catch (const std::invalid_argument &) {
-      throw std::invalid_argument("Rational invalid input");
-    }
+  while (!fracStr.empty() && fracStr.back() == '0') {
+    fracStr.remove_suffix(1);
   }
 
-  toIrreducibleRational();
-  numerator += intPart * denominator;
-  if (numerator != 0) {
+  uint64_t smallVal = 0;
+  if (fracStr.size() <= SMALL_SIZE && toUint64(intStr, smallVal) && toUint64(fracStr, smallVal)) {
+    uint64_t smallDenominatorVal = pow10Small(fracStr.size());
+    uint64_t divider = getPow2Or5Gcd(smallVal, fracStr.size());
     sign = isNegative;
+    setSmall(smallVal / divider, smallDenominatorVal / divider);
+    return;
+  }
+
+  Integer numeratorVal;
+  Integer denominatorVal = 1;
+  if (fracStr.empty()) {
+    numeratorVal = Integer(intStr);
+  } else {
+    std::string digitsStr;
+    digitsStr.reserve(intStr.size() + fracStr.size());
+    digitsStr.append(intStr).append(fracStr);
+    numeratorVal = Integer(digitsStr);
+    denominatorVal = Integer::pow10(fracStr.size());
+    reducePow10(numeratorVal, denominatorVal, fracStr.size());
   }
+  sign = isNegative;
+  setIrreducible(numeratorVal, denominatorVal);
 }
 
-Rational::Rational(Integer val) : numerator(std::move(val)) {
-  fixNegative();
+Rational::Rational(Integer val) {
+  if (val.size() <= SMALL_SIZE) {
+    int64_t smallVal = val.toInt64();
+    sign = smallVal < 0;
+    setSmall(smallVal < 0 ? -(uint64_t)smallVal : (uint64_t)smallVal, 1);
+    return;
+  }
+
+  sign = val < 0;
+  setIrreducible(sign ? -val : val, 1);
 }
 
-Rational::Rational(int64_t val) : numerator(val) {
-  fixNegative();
+Rational::Rational(int64_t val) : sign(val < 0) {
+  setSmall(val < 0 ? -(uint64_t)val : (uint64_t)val, 1);
 }
 
-Rational::Rational(Integer numerator, Integer denominator)
-    : numerator(std::move(numerator)), denominator(std::move(denominator)) {
-  toIrreducibleRational();
+Rational::Rational(Integer numerator, Integer denominator) {
+  if (denominator == 0) {
+    throw std::domain_error("Div by zero");
+  }
+
+  sign = (numerator < 0) != (denominator < 0);
+  if (numerator < 0) {
+    numerator = -numerator;
+  }
+  if (denominator < 0) {
+    denominator = -denominator;
+  }
+
+  Integer gcdVal = gcd(numerator, denominator);
+  numerator.divExact(gcdVal);
+  denominator.divExact(gcdVal);
+  setIrreducible(numerator, denominator);
 }
 
-Rational::Rational(int64_t numerator, int64_t denominator) : numerator(numerator), denominator(denominator) {
-  toIrreducibleRational();
+Rational::Rational(int64_t numerator, int64_t denominator) : sign((numerator < 0) != (denominator < 0)) {
+  if (denominator == 0) {
+    throw std::domain_error("Div by zero");
+  }
+
+  uint64_t absNumerator = numerator < 0 ? -(uint64_t)numerator : (uint64_t)numerator;
+  uint64_t absDenominator = denominator < 0 ? -(uint64_t)denominator : (uint64_t)denominator;
+  uint64_t gcdVal = std::gcd(absNumerator, absDenominator);
+  setSmall(absNumerator / gcdVal, absDenominator / gcdVal);
 }
 
 Rational &Rational::operator=(const Integer &rhs) {
@@ -80,19 +166,22 @@ Rational &Rational::operator=(int64_t rhs) {
 }
 
 Rational &Rational::operator+=(const Rational &rhs) {
-  Rational tmpRhs = rhs;
-  toCommonDenominators(*this, tmpRhs);
-  numerator += tmpRhs.numerator;
-  toIrreducibleRational();
+  add(rhs, rhs.sign);
   return *this;
 }
 
 Rational &Rational::operator+=(const Integer &rhs) {
-  return *this += Rational(rhs);
+  addInteger(rhs, false);
+  return *this;
 }
 
 Rational &Rational::operator+=(int64_t rhs) {
-  return *this += Rational(rhs);
+  if (isSmall()) {
+    addSmallInteger(rhs, false);
+    return *this;
+  }
+  addInteger(rhs, false);
+  return *this;
 }
 
 Rational Rational::operator+(const Rational &rhs) const {
@@ -101,35 +190,40 @@ Rational Rational::operator+(const Rational &rhs) const {
 }
 
 Rational Rational::operator+(const Integer &rhs) const {
-  return *this + Rational(rhs);
+  Rational lhs = *this;
+  return lhs += rhs;
 }
 
 Rational Rational::operator+(int64_t rhs) const {
-  return *this + Rational(rhs);
+  Rational lhs = *this;
+  return lhs += rhs;
 }
 
 Rational operator+(const Integer &lhs, const Rational &rhs) {
-  return Rational(lhs) + rhs;
+  return rhs + lhs;
 }
 
 Rational operator+(int64_t lhs, const Rational &rhs) {
-  return Rational(lhs) + rhs;
+  return rhs + lhs;
 }
 
 Rational &Rational::operator-=(const Rational &rhs) {
-  Rational tmpRhs = rhs;
-  toCommonDenominators(*this, tmpRhs);
-  numerator -= tmpRhs.numerator;
-  toIrreducibleRational();
+  add(rhs, !rhs.sign);
   return *this;
 }
 
 Rational &Rational::operator-=(const Integer &rhs) {
-  return *this -= Rational(rhs);
+  addInteger(rhs, true);
+  return *this;
 }
 
 Rational &Rational::operator-=(int64_t rhs) {
-  return *this -= Rational(rhs);
+  if (isSmall()) {
+    addSmallInteger(rhs, true);
+    return *this;
+  }
+  addInteger(rhs, true);
+  return *this;
 }
 
 Rational Rational::operator-(const Rational &rhs) const {
@@ -138,35 +232,45 @@ Rational Rational::operator-(const Rational &rhs) const {
 }
 
 Rational Rational::operator-(const Integer &rhs) const {
-  return *this - Rational(rhs);
+  Rational lhs = *this;
+  return lhs -= rhs;
 }
 
 Rational Rational::operator-(int64_t rhs) const {
-  return *this - Rational(rhs);
+  Rational lhs = *this;
+  return lhs -= rhs;
 }
 
 Rational operator-(const Integer &lhs, const Rational &rhs) {
-  return Rational(lhs) - rhs;
+  return -rhs + lhs;
 }
 
 Rational operator-(int64_t lhs, const Rational &rhs) {
-  return Rational(lhs) - rhs;
+  return -rhs + lhs;
 }
 
 Rational &Rational::operator*=(const Rational &rhs) {
-  numerator *= rhs.numerator;
-  denominator *= rhs.denominator;
-  sign = !((sign && rhs.sign) || (!sign && !rhs.sign));
-  toIrreducibleRational();
+  if (isSmall() && rhs.isSmall()) {
+    multiplySmall(rhs.smallNumerator, rhs.smallDenominator, rhs.sign);
+    return *this;
+  }
+
+  multiply(rhs.getBigNumerator(), rhs.getBigDenominator(), rhs.sign);
   return *this;
 }
 
 Rational &Rational::operator*=(const Integer &rhs) {
-  return *this *= Rational(rhs);
+  multiplyInteger(rhs, false);
+  return *this;
 }
 
 Rational &Rational::operator*=(int64_t rhs) {
-  return *this *= Rational(rhs);
+  if (isSmall()) {
+    multiplySmallInteger(rhs, false);
+    return *this;
+  }
+  multiplyInteger(rhs, false);
+  return *this;
 }
 
 Rational Rational::operator*(const Rational &rhs) const {
@@ -175,35 +279,48 @@ Rational Rational::operator*(const Rational &rhs) const {
 }
 
 Rational Rational::operator*(const Integer &rhs) const {
-  return *this * Rational(rhs);
+  Rational lhs = *this;
+  return lhs *= rhs;
 }
 
 Rational Rational::operator*(int64_t rhs) const {
-  return *this * Rational(rhs);
+  Rational lhs = *this;
+  return lhs *= rhs;
 }
 
 Rational operator*(const Integer &lhs, const Rational &rhs) {
-  return Rational(lhs) * rhs;
+  return rhs * lhs;
 }
 
 Rational operator*(int64_t lhs, const Rational &rhs) {
-  return Rational(lhs) * rhs;
+  return rhs * lhs;
 }
 
 Rational &Rational::operator/=(const Rational &rhs) {
-  numerator *= rhs.denominator;
-  denominator *= rhs.numerator;
-  sign = !((sign && rhs.sign) || (!sign && !rhs.sign));
-  toIrreducibleRational();
+  if (rhs.isZero()) {
+    throw std::domain_error("Div by zero");
+  }
+  if (isSmall() && rhs.isSmall()) {
+    multiplySmall(rhs.smallDenominator, rhs.smallNumerator, rhs.sign);
+    return *this;
+  }
+
+  multiply(rhs.getBigDenominator(), rhs.getBigNumerator(), rhs.sign);
   return *this;
 }
 
 Rational &Rational::operator/=(const Integer &rhs) {
-  return *this /= Rational(rhs);
+  multiplyInteger(rhs, true);
+  return *this;
 }
 
 Rational &Rational::operator/=(int64_t rhs) {
-  return *this /= Rational(rhs);
+  if (isSmall()) {
+    multiplySmallInteger(rhs, true);
+    return *this;
+  }
+  multiplyInteger(rhs, true);
+  return *this;
 }
 
 Rational Rational::operator/(const Rational &rhs) const {
@@ -212,19 +329,25 @@ Rational Rational::operator/(const Rational &rhs) const {
 }
 
 Rational Rational::operator/(const Integer &rhs) const {
-  return *this / Rational(rhs);
+  Rational lhs = *this;
+  return lhs /= rhs;
 }
 
 Rational Rational::operator/(int64_t rhs) const {
-  return *this / Rational(rhs);
+  Rational lhs = *this;
+  return lhs /= rhs;
 }
 
 Rational operator/(const Integer &lhs, const Rational &rhs) {
-  return Rational(lhs) / rhs;
+  Rational val = rhs;
+  val.inverse();
+  return val *= lhs;
 }
 
 Rational operator/(int64_t lhs, const Rational &rhs) {
-  return Rational(lhs) / rhs;
+  Rational val = rhs;
+  val.inverse();
+  return val *= lhs;
 }
 
 Rational &Rational::operator++() {
@@ -253,28 +376,44 @@ Rational Rational::operator+() const {
 
 Rational Rational::operator-() const {
   Rational val = *this;
-  val.sign = !val.sign;
+  if (!val.isZero()) {
+    val.sign = !val.sign;
+  }
   return val;
 }
 
 bool Rational::operator==(const Rational &rhs) const {
-  return (sign == rhs.sign && numerator == rhs.numerator && denominator == rhs.denominator);
+  if (sign != rhs.sign) {
+    return false;
+  }
+  if (isSmall() && rhs.isSmall()) {
+    return smallNumerator == rhs.smallNumerator && smallDenominator == rhs.smallDenominator;
+  }
+  return getBigNumerator() == rhs.getBigNumerator() && getBigDenominator() == rhs.getBigDenominator();
 }
 
+// Irreducible fractions equal to integers have the denominator 1
 bool Rational::operator==(const Integer &rhs) const {
-  return *this == Rational(rhs);
+  if (isSmall()) {
+    return smallDenominator == 1 && rhs.size() <= SMALL_SIZE && *this == rhs.toInt64();
+  }
+  return getBigDenominator() == 1 && sign == (rhs < 0) && getBigNumerator() == (sign ? -rhs : rhs);
 }
 
 bool Rational::Rational::operator==(int64_t rhs) const {
-  return *this == Rational(rhs);
+  if (isSmall()) {
+    return smallDenominator == 1 && sign == (rhs < 0) &&
+           (uint64_t)smallNumerator == (rhs < 0 ? -(uint64_t)rhs : (uint64_t)rhs);
+  }
+  return *this == Integer(rhs);
 }
 
 bool operator==(const Integer &lhs, const Rational &rhs) {
-  return Rational(lhs) == rhs;
+  return rhs == lhs;
 }
 
 bool operator==(int64_t lhs, const Rational &rhs) {
-  return Rational(lhs) == rhs;
+  return rhs == lhs;
 }
 
 bool Rational::operator!=(const Rational &rhs) const {
@@ -298,10 +437,7 @@ bool operator!=(int64_t lhs, const Rational &rhs) {
 }
 
 bool Rational::operator<(const Rational &rhs) const {
-  Rational lhs = *this;
-  Rational tmpRhs = rhs;
-  toCommonDenominators(lhs, tmpRhs);
-  return (lhs.numerator < tmpRhs.numerator);
+  return compare(*this, rhs) < 0;
 }
 
 bool Rational::operator<(const Integer &rhs) const {
@@ -321,10 +457,7 @@ bool operator<(int64_t lhs, const Rational &rhs) {
 }
 
 bool Rational::operator>(const Rational &rhs) const {
-  Rational lhs = *this;
-  Rational tmpRhs = rhs;
-  toCommonDenominators(lhs, tmpRhs);
-  return (lhs.numerator > tmpRhs.numerator);
+  return compare(*this, rhs) > 0;
 }
 
 bool Rational::operator>(const Integer &rhs) const {
@@ -344,10 +477,7 @@ bool operator>(int64_t lhs, const Rational &rhs) {
 }
 
 bool Rational::operator<=(const Rational &rhs) const {
-  Rational lhs = *this;
-  Rational tmpRhs = rhs;
-  toCommonDenominators(lhs, tmpRhs);
-  return (lhs.numerator <= tmpRhs.numerator);
+  return compare(*this, rhs) <= 0;
 }
 
 bool Rational::operator<=(const Integer &rhs) const {
@@ -367,10 +497,7 @@ bool operator<=(int64_t lhs, const Rational &rhs) {
 }
 
 bool Rational::operator>=(const Rational &rhs) const {
-  Rational lhs = *this;
-  Rational tmpRhs = rhs;
-  toCommonDenominators(lhs, tmpRhs);
-  return (lhs.numerator >= tmpRhs.numerator);
+  return compare(*this, rhs) >= 0;
 }
 
 bool Rational::operator>=(const Integer &rhs) const {
@@ -401,31 +528,28 @@ std::ostream &operator<<(std::ostream &out, const Rational &rhs) {
 }
 
 Integer Rational::getInteger() const {
-  return numerator / denominator;
+  if (isSmall()) {
+    return smallNumerator / smallDenominator;
+  }
+  return getBigNumerator() / getBigDenominator();
 }
 
 Integer Rational::getNumerator() const {
-  return numerator % denominator;
+  if (isSmall()) {
+    return smallNumerator % smallDenominator;
+  }
+  return getBigNumerator() % getBigDenominator();
 }
 
 Integer Rational::getDenominator() const {
-  return denominator;
+  if (isSmall()) {
+    return smallDenominator;
+  }
+  return Integer(big->getDenominator(), false);
 }
 
 std::string Rational::toString(size_t precision) const {
-  const int64_t base = 10;
-  const int64_t roundUp = 5;
-
-  std::string precisionStr(precision + 2, '0');
-  precisionStr.front() = '1';
-
-  Integer val = numerator * Integer(precisionStr) / denominator;
-  if (val % base >= roundUp) {
-    val += base;
-  }
-  val /= base;
-
-  std::string strVal = val.toString();
+  std::string strVal = getRoundedNumerator(precision).toString();
   if (strVal.size() <= precision) {
     strVal.insert(strVal.begin(), precision + 1 - strVal.size(), '0');
   }
@@ -446,7 +570,95 @@ std::string Rational::toString(size_t precision) const {
 }
 
 Rational Rational::round(size_t precision) const {
-  return Rational(toString(precision));
+  Rational val = fromDecimal(getRoundedNumerator(precision), precision);
+  if (!val.isZero()) {
+    val.sign = sign;
+  }
+  return val;
+}
+
+// The gcd of a number and 10^power is a power of 2 times a power of 5, which are divided out by reducePow10
+Rational Rational::fromDecimal(Integer numerator, size_t power) {
+  Rational val;
+  if (numerator == 0) {
+    return val;
+  }
+
+  val.sign = numerator < 0;
+  if (val.sign) {
+    numerator = -numerator;
+  }
+  Integer denominator = Integer::pow10(power);
+  reducePow10(numerator, denominator, power);
+  val.setIrreducible(numerator, denominator);
+  return val;
+}
+
+/*
+  Convergents p_n/q_n of the continued fraction of the fractional part are taken while q_n <= maxDenominator. Then the
+  best one of p_n/q_n and the semiconvergent (p_{n-1} + k*p_n) / (q_{n-1} + k*q_n) with the greatest possible k is
+  chosen.
+*/
+Rational Rational::limitDenominator(const Integer &maxDenominator) const {
+  if (maxDenominator < 1) {
+    throw std::domain_error("limitDenominator out of range");
+  }
+
+  Integer valDenominator = getDenominator();
+  if (valDenominator <= maxDenominator) {
+    return *this;
+  }
+  Integer valNumerator = getNumerator();
+  Rational fracVal(valNumerator, valDenominator);
+
+  Integer prevNumerator = 0;
+  Integer prevDenominator = 1;
+  Integer curNumerator = 1;
+  Integer curDenominator = 0;
+  while (true) {
+    Integer quotient = valNumerator / valDenominator;
+    Integer nextDenominator = mulAdd(quotient, curDenominator, prevDenominator);
+    if (nextDenominator > maxDenominator) {
+      break;
+    }
+
+    Integer nextNumerator = mulAdd(quotient, curNumerator, prevNumerator);
+    prevNumerator = std::move(curNumerator);
+    prevDenominator = std::move(curDenominator);
+    curNumerator = std::move(nextNumerator);
+    curDenominator = std::move(nextDenominator);
+
+    subMul(valNumerator, quotient, valDenominator);
+    std::swap(valNumerator, valDenominator);
+  }
+
+  Integer multiplier = (maxDenominator - prevDenominator) / curDenominator;
+  Rational semiconvergent(mulAdd(multiplier, curNumerator, prevNumerator),
+                          mulAdd(multiplier, curDenominator, prevDenominator));
+  Rational convergent(curNumerator, curDenominator);
+
+  Rational convergentDiff = convergent - fracVal;
+  Rational semiconvergentDiff = semiconvergent - fracVal;
+  Rational val = getInteger() + (convergentDiff * convergentDiff <= semiconvergentDiff * semiconvergentDiff
+                                     ? convergent
+                                     : semiconvergent);
+  return sign ? -val : val;
+}
+
+Rational Rational::bestApproximation(const Rational &tolerance) const {
+  if (tolerance < 0) {
+    throw std::domain_error("bestApproximation out of range");
+  }
+
+  Rational lower = *this - tolerance;
+  Rational upper = *this + tolerance;
+  if (lower <= 0 && upper >= 0) {
+    return 0;
+  }
+  if (upper < 0) {
+    return -getSimplest(-upper, -lower);
+  }
+  return getSimplest(lower, upper);
 }
 
 std::string Rational::getTypeName() const {
@@ -457,51 +669,361 @@ std::string Rational::toString() const {
   return toString(INITIAL_PRECISION);
 }
 
-void Rational::fixZero() {
-  if (numerator == 0) {
+Rational::BigBlock *Rational::createBig(size_t capacity) {
+  void *ptr = SpillStore::allocate(sizeof(BigBlock) + capacity * sizeof(int64_t));
+  return new (ptr) BigBlock(capacity);
+}
+
+void Rational::retainBig(BigBlock *block) noexcept {
+  block->refsNum.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Rational::releaseBig(BigBlock *block) noexcept {
+  if (block->refsNum.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    return;
+  }
+  size_t size = sizeof(BigBlock) + block->capacity * sizeof(int64_t);
+  block->~BigBlock();
+  SpillStore::deallocate(block, size);
+}
+
+bool Rational::isSmall() const {
+  return big == nullptr;
+}
+
+// Zero is always small
+bool Rational::isZero() const {
+  return isSmall() && smallNumerator == 0;
+}
+
+/*
+  The magnitudes of the numerator and the denominator. The digits of a big Rational are read right from its block, so
+  the results must not outlive it or be used after it is changed.
+*/
+Integer Rational::getBigNumerator() const {
+  if (isSmall()) {
+    return smallNumerator;
+  }
+  return Integer(big->getNumerator(), true);
+}
+
+Integer Rational::getBigDenominator() const {
+  if (isSmall()) {
+    return smallDenominator;
+  }
+  return Integer(big->getDenominator(), true);
+}
+
+// Sets the irreducible magnitude, the block is used if it does not fit in int64_t
+void Rational::setSmall(unsigned __int128 numeratorVal, unsigned __int128 denominatorVal) {
+  if (numeratorVal == 0) {
+    denominatorVal = 1;
     sign = false;
-    denominator = 1;
+  }
+
+  if (numeratorVal > INT64_MAX || denominatorVal > INT64_MAX) {
+    setBig(toInteger(numeratorVal), toInteger(denominatorVal));
+    return;
+  }
+
+  smallNumerator = (int64_t)numeratorVal;
+  smallDenominator = (int64_t)denominatorVal;
+  if (big) {
+    releaseBig(std::exchange(big, nullptr));
   }
 }
 
-void Rational::fixNegative() {
-  if (numerator < 0) {
-    numerator *= -1;
-    sign = !sign;
+// Sets the irreducible magnitude, it is moved to machine words if it fits
+void Rational::setIrreducible(const Integer &numeratorVal, const Integer &denominatorVal) {
+  if (numeratorVal.size() <= SMALL_SIZE && denominatorVal.size() <= SMALL_SIZE) {
+    setSmall((uint64_t)numeratorVal.toInt64(), (uint64_t)denominatorVal.toInt64());
+    return;
   }
-  if (denominator < 0) {
-    denominator *= -1;
-    sign = !sign;
+  setBig(numeratorVal, denominatorVal);
+}
+
+/*
+  The digits are written over the block if it is not shared, large enough and they are not read from it. Otherwise they
+  are copied to a new block, and the old one is released after that.
+*/
+void Rational::setBig(const Integer &numeratorVal, const Integer &denominatorVal) {
+  IntSpan numeratorDigits = numeratorVal.getIntVect();
+  IntSpan denominatorDigits = denominatorVal.getIntVect();
+  size_t size = numeratorDigits.size() + denominatorDigits.size();
+
+  BigBlock *block = big;
+  if (!block || block->capacity < size || !block->isUnique() || block->contains(numeratorDigits.data()) ||
+      block->contains(denominatorDigits.data())) {
+    block = createBig(size);
   }
+
+  std::copy(numeratorDigits.begin(), numeratorDigits.end(), block->getDigits());
+  std::copy(denominatorDigits.begin(), denominatorDigits.end(), block->getDigits() + numeratorDigits.size());
+  block->numeratorSize = numeratorDigits.size();
+  block->denominatorSize = denominatorDigits.size();
+
+  if (block != big) {
+    if (big) {
+      releaseBig(big);
+    }
+    big = block;
+  }
+  smallNumerator = 0;
+  smallDenominator = 1;
 }
 
-void Rational::toIrreducibleRational() {
-  if (denominator == 0) {
+// Henrici's addition in machine words, the products of int64_t values fit in __int128
+void Rational::addSmall(const Rational &rhs, bool isRhsNegative) {
+  int64_t gcdVal = std::gcd(smallDenominator, rhs.smallDenominator);
+  int64_t lhsMultiplier = rhs.smallDenominator / gcdVal;
+  int64_t rhsMultiplier = smallDenominator / gcdVal;
+
+  __int128 lhsVal = (__int128)smallNumerator * lhsMultiplier;
+  __int128 rhsVal = (__int128)rhs.smallNumerator * rhsMultiplier;
+  __int128 val = (sign ? -lhsVal : lhsVal) + (isRhsNegative ? -rhsVal : rhsVal);
+
+  sign = val < 0;
+  auto absVal = (unsigned __int128)(val < 0 ? -val : val);
+  int64_t valGcd = std::gcd((int64_t)(absVal % (uint64_t)gcdVal), gcdVal);
+  setSmall(absVal / (uint64_t)valGcd, (unsigned __int128)(smallDenominator / valGcd) * (uint64_t)lhsMultiplier);
+}
+
+// Henrici's multiplication in machine words
+void Rational::multiplySmall(int64_t rhsNumerator, int64_t rhsDenominator, bool isRhsNegative) {
+  int64_t lhsGcd = std::gcd(smallNumerator, rhsDenominator);
+  int64_t rhsGcd = std::gcd(rhsNumerator, smallDenominator);
+  sign = sign != isRhsNegative;
+  setSmall((unsigned __int128)(smallNumerator / lhsGcd) * (uint64_t)(rhsNumerator / rhsGcd),
+           (unsigned __int128)(smallDenominator / rhsGcd) * (uint64_t)(rhsDenominator / lhsGcd));
+}
+
+// a/b + n = (a + n*b) / b is irreducible if a/b is
+void Rational::addInteger(const Integer &rhs, bool isRhsNegated) {
+  if (isSmall() && rhs.size() <= SMALL_SIZE) {
+    addSmallInteger(rhs.toInt64(), isRhsNegated);
+    return;
+  }
+
+  Integer val = getBigNumerator();
+  if (sign) {
+    val = -val;
+  }
+  Integer denominatorVal = getBigDenominator();
+  if (isRhsNegated) {
+    subMul(val, rhs, denominatorVal);
+  } else {
+    addMul(val, rhs, denominatorVal);
+  }
+
+  sign = val < 0;
+  setIrreducible(sign ? -val : val, denominatorVal);
+}
+
+void Rational::addSmallInteger(int64_t rhs, bool isRhsNegated) {
+  __int128 rhsVal = isRhsNegated ? -(__int128)rhs : (__int128)rhs;
+  __int128 val = (sign ? -(__int128)smallNumerator : (__int128)smallNumerator) + rhsVal * smallDenominator;
+
+  sign = val < 0;
+  setSmall((unsigned __int128)(val < 0 ? -val : val), (uint64_t)smallDenominator);
+}
+
+/*
+  a/b * n = (a * (n/g)) / (b/g), where g = gcd(n, b), and a/b / n = (a/g) / (b * (n/g)), where g = gcd(a, n).
+*/
+void Rational::multiplyInteger(const Integer &rhs, bool isDivision) {
+  if (isDivision && rhs == 0) {
     throw std::domain_error("Div by zero");
   }
-  fixNegative();
-  Integer gcdVal = gcd(numerator, denominator);
-  numerator /= gcdVal;
-  denominator /= gcdVal;
-  fixZero();
+  if (isSmall() && rhs.size() <= SMALL_SIZE) {
+    multiplySmallInteger(rhs.toInt64(), isDivision);
+    return;
+  }
+
+  sign = sign != (rhs < 0);
+  Integer rhsAbs = rhs < 0 ? -rhs : rhs;
+  Integer numeratorVal = getBigNumerator();
+  Integer denominatorVal = getBigDenominator();
+  Integer &multiplied = isDivision ? denominatorVal : numeratorVal;
+  Integer &reduced = isDivision ? numeratorVal : denominatorVal;
+
+  Integer gcdVal = gcd(rhsAbs, reduced);
+  if (gcdVal != 1) {
+    rhsAbs.divExact(gcdVal);
+    reduced.divExact(gcdVal);
+  }
+  multiplied *= rhsAbs;
+  setIrreducible(numeratorVal, denominatorVal);
+}
+
+void Rational::multiplySmallInteger(int64_t rhs, bool isDivision) {
+  if (isDivision && rhs == 0) {
+    throw std::domain_error("Div by zero");
+  }
+
+  sign = sign != (rhs < 0);
+  uint64_t rhsAbs = rhs < 0 ? -(uint64_t)rhs : (uint64_t)rhs;
+  auto lhsNumerator = (uint64_t)smallNumerator;
+  auto lhsDenominator = (uint64_t)smallDenominator;
+
+  if (isDivision) {
+    uint64_t gcdVal = std::gcd(lhsNumerator, rhsAbs);
+    setSmall(lhsNumerator / gcdVal, (unsigned __int128)lhsDenominator * (rhsAbs / gcdVal));
+  } else {
+    uint64_t gcdVal = std::gcd(rhsAbs, lhsDenominator);
+    setSmall((unsigned __int128)lhsNumerator * (rhsAbs / gcdVal), lhsDenominator / gcdVal);
+  }
+}
+
+void Rational::inverse() {
+  if (isZero()) {
+    throw std::domain_error("Div by zero");
+  }
+  if (isSmall()) {
+    std::swap(smallNumerator, smallDenominator);
+  } else {
+    setBig(getBigDenominator(), getBigNumerator());
+  }
+}
+
+// |this| * 10^precision rounded half up, the only division is the one by the denominator
+Integer Rational::getRoundedNumerator(size_t precision) const {
+  const int64_t base = 10;
+  const int64_t roundUp = 5;
+
+  Integer val = getBigNumerator();
+  val *= Integer::pow10(precision);
+  val *= base;
+  val /= getBigDenominator();
+  if (val % base >= roundUp) {
+    val += base;
+  }
+  return val / base;
+}
+
+/*
+  Henrici's addition: a/b + c/d with g = gcd(b, d) is t / (b/g * d), where t = a * (d/g) + c * (b/g). The fraction is
+  reduced only by gcd(t, g), all the other common factors are absent if a/b and c/d are irreducible.
+*/
+void Rational::add(const Rational &rhs, bool isRhsNegative) {
+  if (isSmall() && rhs.isSmall()) {
+    addSmall(rhs, isRhsNegative);
+    return;
+  }
+
+  Integer gcdVal = gcd(getBigDenominator(), rhs.getBigDenominator());
+
+  Integer lhsMultiplier = rhs.getBigDenominator();
+  Integer rhsMultiplier = getBigDenominator();
+  if (gcdVal != 1) {
+    lhsMultiplier.divExact(gcdVal);
+    rhsMultiplier.divExact(gcdVal);
+  }
+
+  Integer val = getBigNumerator();
+  val *= lhsMultiplier;
+  if (sign) {
+    val = -val;
+  }
+  if (isRhsNegative) {
+    subMul(val, rhs.getBigNumerator(), rhsMultiplier);
+  } else {
+    addMul(val, rhs.getBigNumerator(), rhsMultiplier);
+  }
+
+  sign = val < 0;
+  if (sign) {
+    val = -val;
+  }
+
+  Integer denominatorVal = getBigDenominator();
+  if (gcdVal != 1) {
+    Integer valGcd = gcd(val, gcdVal);
+    if (valGcd != 1) {
+      val.divExact(valGcd);
+      denominatorVal.divExact(valGcd);
+    }
+  }
+  denominatorVal *= lhsMultiplier;
+  setIrreducible(val, denominatorVal);
 }
 
-void Rational::toCommonDenominators(Rational &lhs, Rational &rhs) {
-  Integer lcmVal = lcm(lhs.denominator, rhs.denominator);
+/*
+  Henrici's multiplication: a/b * c/d = (a/g1 * c/g2) / (b/g2 * d/g1), where g1 = gcd(a, d) and g2 = gcd(c, b).
+*/
+void Rational::multiply(Integer rhsNumerator, Integer rhsDenominator, bool isRhsNegative) {
+  sign = sign != isRhsNegative;
+
+  Integer numeratorVal = getBigNumerator();
+  Integer denominatorVal = getBigDenominator();
+  Integer lhsGcd = gcd(numeratorVal, rhsDenominator);
+  Integer rhsGcd = gcd(rhsNumerator, denominatorVal);
 
-  if (lhs.sign) {
-    lhs.numerator *= -1;
+  if (lhsGcd != 1) {
+    numeratorVal.divExact(lhsGcd);
+    rhsDenominator.divExact(lhsGcd);
+  }
+  if (rhsGcd != 1) {
+    rhsNumerator.divExact(rhsGcd);
+    denominatorVal.divExact(rhsGcd);
+  }
+
+  numeratorVal *= rhsNumerator;
+  denominatorVal *= rhsDenominator;
+  setIrreducible(numeratorVal, denominatorVal);
+}
+
+/*
+  Comparing signs first, then the magnitudes estimated by the numbers of digits: if a/b and c/d are positive, then
+  10^(size(a) - size(b) - 1) < a/b < 10^(size(a) - size(b) + 1). Only if the estimates overlap, a*d and c*b are
+  compared.
+*/
+int Rational::compare(const Rational &lhs, const Rational &rhs) {
+  int lhsSign = lhs.sign ? -1 : (lhs.isZero() ? 0 : 1);
+  int rhsSign = rhs.sign ? -1 : (rhs.isZero() ? 0 : 1);
+  if (lhsSign != rhsSign) {
+    return lhsSign < rhsSign ? -1 : 1;
+  }
+  if (lhsSign == 0) {
+    return 0;
   }
-  lhs.numerator *= (lcmVal / lhs.denominator);
-  lhs.denominator = lcmVal;
-  lhs.sign = false;
 
-  if (rhs.sign) {
-    rhs.numerator *= -1;
+  if (lhs.isSmall() && rhs.isSmall()) {
+    __int128 lhsVal = (__int128)lhs.smallNumerator * rhs.smallDenominator;
+    __int128 rhsVal = (__int128)rhs.smallNumerator * lhs.smallDenominator;
+    return lhsSign * (lhsVal < rhsVal ? -1 : (lhsVal == rhsVal ? 0 : 1));
   }
-  rhs.numerator *= (lcmVal / rhs.denominator);
-  rhs.denominator = lcmVal;
-  rhs.sign = false;
+
+  Integer lhsVal = lhs.getBigNumerator();
+  Integer rhsVal = rhs.getBigNumerator();
+  auto lhsOrder = (int64_t)lhsVal.size() - (int64_t)lhs.getBigDenominator().size();
+  auto rhsOrder = (int64_t)rhsVal.size() - (int64_t)rhs.getBigDenominator().size();
+
+  int res = 0;
+  if (lhsOrder > rhsOrder + 1) {
+    res = 1;
+  } else if (lhsOrder + 1 < rhsOrder) {
+    res = -1;
+  } else {
+    lhsVal *= rhs.getBigDenominator();
+    rhsVal *= lhs.getBigDenominator();
+    res = lhsVal < rhsVal ? -1 : (lhsVal == rhsVal ? 0 : 1);
+  }
+
+  return lhsSign * res;
+}
+
+// Other owners may have released the block in other threads, the fence makes their reads happen before the changes
+bool Rational::BigBlock::isUnique() const {
+  if (refsNum.load(std::memory_order_relaxed) != 1) {
+    return false;
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return true;
+}
+
+bool Rational::BigBlock::contains(const int64_t *ptr) const {
+  std::less<const int64_t *> less;
+  return !less(ptr, getDigits()) && less(ptr, getDigits() + capacity);
 }
 
 // Using Euclid's algorithm
@@ -516,7 +1038,112 @@ static Integer gcd(const Integer &lhs, const Integer &rhs) {
   return tmpLhs;
 }
 
-// Using the formula lcm(a, b) = a * b / gcd(a, b)
-static Integer lcm(const Integer &lhs, const Integer &rhs) {
-  return lhs * rhs / gcd(lhs, rhs);
+static Integer toInteger(unsigned __int128 rhs) {
+  const int64_t base = 1000000000000000000;
+
+  auto low = (int64_t)(rhs % base);
+  rhs /= base;
+  auto mid = (int64_t)(rhs % base);
+  rhs /= base;
+  return mulAdd(mulAdd(Integer((int64_t)rhs), base, mid), base, low);
+}
+
+/*
+  The fraction with the least denominator in [lhs, rhs], where 0 < lhs <= rhs. If there is no integer in the segment,
+  the integer part is the same for all its points, and the rest is found in [1/(rhs - a), 1/(lhs - a)] the same way.
+*/
+static Rational getSimplest(const Rational &lhs, const Rational &rhs) {
+  Integer lhsInteger = lhs.getInteger();
+  if (lhs.getNumerator() == 0) {
+    return lhsInteger;
+  }
+  if (lhsInteger < rhs.getInteger()) {
+    return lhsInteger + 1;
+  }
+  return lhsInteger + 1 / getSimplest(1 / (rhs - lhsInteger), 1 / (lhs - lhsInteger));
+}
+
+static bool isDigits(std::string_view strVal) {
+  return std::all_of(strVal.begin(), strVal.end(), [](char ch) { return ch >= '0' && ch <= '9'; });
+}
+
+// Appends the digits to val, false is returned if the result does not fit in int64_t
+static bool toUint64(std::string_view strVal, uint64_t &val) {
+  const uint64_t base = 10;
+  const uint64_t maxVal = (INT64_MAX - (base - 1)) / base;
+
+  for (char ch : strVal) {
+    if (val > maxVal) {
+      return false;
+    }
+    val = val * base + (ch - '0');
+  }
+  return true;
+}
+
+static uint64_t pow10Small(size_t rhs) {
+  const uint64_t base = 10;
+
+  uint64_t val = 1;
+  for (size_t i = 0; i < rhs; i++) {
+    val *= base;
+  }
+  return val;
+}
+
+// gcd(val, 10^power) for val that is not divisible by 10, so it is a power of 2 or a power of 5
+static uint64_t getPow2Or5Gcd(uint64_t val, size_t power) {
+  const uint64_t prime = 5;
+
+  if (val == 0) {
+    return pow10Small(power);
+  }
+
+  auto twosNum = std::min((size_t)__builtin_ctzll(val), power);
+  if (twosNum != 0) {
+    return uint64_t(1) << twosNum;
+  }
+
+  uint64_t divider = 1;
+  for (size_t i = 0; i < power && val % prime == 0; i++) {
+    val /= prime;
+    divider *= prime;
+  }
+  return divider;
+}
+
+/*
+  Reduces numerator / 10^power. The powers of 2 and 5 are divided out by chunks fitting in a digit of Integer, the
+  remainder of the last chunk tells how many factors are left.
+*/
+static void reducePow10(Integer &numerator, Integer &denominator, size_t power) {
+  const int64_t chunkSize2 = 29;
+  const int64_t chunkSize5 = 12;
+
+  for (auto [prime, chunkSize] : {std::pair<int64_t, size_t>{2, chunkSize2}, {5, chunkSize5}}) {
+    for (size_t reducedNum = 0; reducedNum < power;) {
+      size_t chunk = std::min(chunkSize, power - reducedNum);
+      int64_t divider = 1;
+      for (size_t i = 0; i < chunk; i++) {
+        divider *= prime;
+      }
+
+      int64_t modVal = (numerator % divider).toInt64();
+      if (modVal != 0) {
+        divider = 1;
+        while (modVal % prime == 0) {
+          modVal /= prime;
+          divider *= prime;
+        }
+      }
+      if (divider != 1) {
+        numerator /= divider;
+        denominator /= divider;
+      }
+      if (modVal != 0) {
+        break;
+      }
+      reducedNum += chunk;
+    }
+  }
 }
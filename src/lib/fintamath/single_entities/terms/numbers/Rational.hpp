@@ -5,6 +5,8 @@
 #include <cstdint>
 #include <iosfwd>
 #include <string>
+#include <string_view>
+#include <utility>
 
 #include "single_entities/ISingleEntity.hpp"
 #include "single_entities/terms/numbers/Integer.hpp"
@@ -12,7 +14,7 @@
 class Rational : public ISingleEntity {
 public:
   Rational() = default;
-  explicit Rational(const std::string &strVal);
+  explicit Rational(std::string_view strVal);
   // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
   Rational(Integer val);
   // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
@@ -20,6 +22,12 @@ public:
   Rational(Integer numerator, Integer denominator);
   Rational(int64_t numerator, int64_t denominator);
 
+  Rational(const Rational &rhs);
+  Rational(Rational &&rhs) noexcept;
+  Rational &operator=(const Rational &rhs);
+  Rational &operator=(Rational &&rhs) noexcept;
+  ~Rational() override;
+
   Rational &operator=(const Integer &rhs);
   Rational &operator=(int64_t rhs);
 
@@ -113,19 +121,102 @@ public:
 
   Rational round(size_t precision) const;
 
+  // numerator / 10^power, reduced without the gcd
+  static Rational fromDecimal(Integer numerator, size_t power);
+
+  // The closest fraction with the denominator not greater than maxDenominator
+  Rational limitDenominator(const Integer &maxDenominator) const;
+  // The fraction with the least denominator that differs from this one by at most tolerance
+  Rational bestApproximation(const Rational &tolerance) const;
+
   std::string toString() const override;
   std::string toString(size_t precision) const;
   std::string getTypeName() const override;
 
 private:
-  Integer numerator = 0;
-  Integer denominator = 1;
+  /*
+    Irreducible fractions with the numerator and the denominator fitting in int64_t are kept in smallNumerator and
+    smallDenominator, their arithmetic is done in machine words without allocations. Bigger ones keep the digits of both
+    magnitudes in one block behind a single header, the block is shared between copies. The sign is always in sign.
+  */
+  struct BigBlock;
+
+  BigBlock *big = nullptr;
+  int64_t smallNumerator = 0;
+  int64_t smallDenominator = 1;
   bool sign{};
 
-  void fixNegative();
-  void fixZero();
-  void toIrreducibleRational();
-  static void toCommonDenominators(Rational &lhs, Rational &rhs);
+  static BigBlock *createBig(size_t capacity);
+  static void retainBig(BigBlock *block) noexcept;
+  static void releaseBig(BigBlock *block) noexcept;
+
+  bool isSmall() const;
+  bool isZero() const;
+  Integer getBigNumerator() const;
+  Integer getBigDenominator() const;
+  void setSmall(unsigned __int128 numeratorVal, unsigned __int128 denominatorVal);
+  void setIrreducible(const Integer &numeratorVal, const Integer &denominatorVal);
+  void setBig(const Integer &numeratorVal, const Integer &denominatorVal);
+  void addSmall(const Rational &rhs, bool isRhsNegative);
+  void multiplySmall(int64_t rhsNumerator, int64_t rhsDenominator, bool isRhsNegative);
+  void addInteger(const Integer &rhs, bool isRhsNegated);
+  void addSmallInteger(int64_t rhs, bool isRhsNegated);
+  void multiplyInteger(const Integer &rhs, bool isDivision);
+  void multiplySmallInteger(int64_t rhs, bool isDivision);
+  void inverse();
+  Integer getRoundedNumerator(size_t precision) const;
+  void add(const Rational &rhs, bool isRhsNegative);
+  void multiply(Integer rhsNumerator, Integer rhsDenominator, bool isRhsNegative);
+  static int compare(const Rational &lhs, const Rational &rhs);
 };
 
+// Small Rationals are copied, moved and destroyed without calls
+inline Rational::Rational(const Rational &rhs)
+    : ISingleEntity(rhs), big(rhs.big), smallNumerator(rhs.smallNumerator), smallDenominator(rhs.smallDenominator),
+      sign(rhs.sign) {
+  if (big) {
+    retainBig(big);
+  }
+}
+
+// A moved big Rational is left equal to 0
+inline Rational::Rational(Rational &&rhs) noexcept
+    : ISingleEntity(std::move(rhs)), big(rhs.big), smallNumerator(rhs.smallNumerator),
+      smallDenominator(rhs.smallDenominator), sign(rhs.sign) {
+  if (big) {
+    rhs.big = nullptr;
+    rhs.sign = false;
+  }
+}
+
+inline Rational &Rational::operator=(const Rational &rhs) {
+  if (this != &rhs) {
+    *this = Rational(rhs);
+  }
+  return *this;
+}
+
+inline Rational &Rational::operator=(Rational &&rhs) noexcept {
+  if (this != &rhs) {
+    if (big) {
+      releaseBig(big);
+    }
+    big = rhs.big;
+    smallNumerator = rhs.smallNumerator;
+    smallDenominator = rhs.smallDenominator;
+    sign = rhs.sign;
+    if (big) {
+      rhs.big = nullptr;
+      rhs.sign = false;
+    }
+  }
+  return *this;
+}
+
+inline Rational::~Rational() {
+  if (big) {
+    releaseBig(big);
+  }
+}
+
 #endif // RATIONAL_HPP
@@ -0,0 +1,85 @@
+#include "single_entities/terms/numbers/SpillAllocator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <fcntl.h>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+
+constexpr size_t NO_SPILL_SIZE = std::numeric_limits<size_t>::max();
+
+// Every block is preceded by a header, so it is freed without a lookup and without the lock
+struct alignas(std::max_align_t) BlockHeader {
+  bool isMapped;
+};
+
+constexpr size_t HEADER_SIZE = sizeof(BlockHeader);
+
+static std::mutex spillMutex;
+static std::string spillDirectory;
+
+// Allocations of less than spillSize bytes use operator new
+static std::atomic<size_t> spillSize = NO_SPILL_SIZE;
+
+static void *mapFile(const std::string &directory, size_t size);
+
+static void *toBlock(void *ptr, bool isMapped) {
+  auto *header = static_cast<BlockHeader *>(ptr);
+  header->isMapped = isMapped;
+  return header + 1;
+}
+
+void SpillStore::setDirectory(const std::string &directory, size_t minSize) {
+  std::lock_guard lock(spillMutex);
+  spillDirectory = directory;
+  spillSize = directory.empty() ? NO_SPILL_SIZE : std::max(minSize, size_t(1));
+}
+
+void *SpillStore::allocate(size_t size) {
+  if (size < spillSize) {
+    return toBlock(::operator new(size + HEADER_SIZE), false);
+  }
+
+  std::lock_guard lock(spillMutex);
+  if (spillDirectory.empty()) {
+    return toBlock(::operator new(size + HEADER_SIZE), false);
+  }
+
+  return toBlock(mapFile(spillDirectory, size + HEADER_SIZE), true);
+}
+
+void SpillStore::deallocate(void *ptr, size_t size) noexcept {
+  BlockHeader *header = static_cast<BlockHeader *>(ptr) - 1;
+  if (header->isMapped) {
+    munmap(header, size + HEADER_SIZE);
+    return;
+  }
+
+  ::operator delete(header);
+}
+
+// The space is reserved on the disk, so its lack is reported here and not by a signal on the first write
+static void *mapFile(const std::string &directory, size_t size) {
+  std::string path = directory + "/fintamath-XXXXXX";
+  int file = mkstemp(path.data());
+  if (file < 0) {
+    throw std::bad_alloc();
+  }
+  unlink(path.c_str());
+
+  void *ptr = MAP_FAILED;
+  if (posix_fallocate(file, 0, (off_t)size) == 0) {
+    ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+  }
+  close(file);
+
+  if (ptr == MAP_FAILED) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
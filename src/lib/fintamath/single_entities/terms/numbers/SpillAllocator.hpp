@@ -0,0 +1,49 @@
+/*
+  SpillAllocator places allocations of at least the spill size into memory-mapped files of the spill directory, so the
+  numbers larger than the memory are paged to the local disk by the kernel. The files are unlinked right after they are
+  created and disappear with the mappings. Smaller allocations, as well as all of them while the directory is not set,
+  use operator new. Allocations that cannot be placed on the disk throw std::bad_alloc.
+*/
+#ifndef SPILLALLOCATOR_HPP
+#define SPILLALLOCATOR_HPP
+
+#include <cstddef>
+#include <string>
+
+class SpillStore {
+public:
+  // An empty directory turns spilling off, the allocations that are already mapped stay valid
+  static void setDirectory(const std::string &directory, size_t minSize);
+
+  static void *allocate(size_t size);
+  static void deallocate(void *ptr, size_t size) noexcept;
+};
+
+template <typename T> class SpillAllocator {
+public:
+  using value_type = T;
+
+  SpillAllocator() = default;
+
+  // cppcheck-suppress noExplicitConstructor // NOLINTNEXTLINE
+  template <typename U> SpillAllocator(const SpillAllocator<U> & /*rhs*/) noexcept {
+  }
+
+  T *allocate(size_t size) {
+    return static_cast<T *>(SpillStore::allocate(size * sizeof(T)));
+  }
+
+  void deallocate(T *ptr, size_t size) noexcept {
+    SpillStore::deallocate(ptr, size * sizeof(T));
+  }
+
+  template <typename U> bool operator==(const SpillAllocator<U> & /*rhs*/) const noexcept {
+    return true;
+  }
+
+  template <typename U> bool operator!=(const SpillAllocator<U> & /*rhs*/) const noexcept {
+    return false;
+  }
+};
+
+#endif // SPILLALLOCATOR_HPP
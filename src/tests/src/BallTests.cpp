@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "single_entities/operators/NamespaceFunctions.hpp"
+#include "single_entities/terms/numbers/Ball.hpp"
+
+TEST(BallTests, constructorTest) {
+  EXPECT_EQ(Ball(Rational(1, 3)).getRadius(), 0);
+  EXPECT_EQ(Ball(1, Rational(-1, 3)).getRadius(), Rational(334, 1000));
+  EXPECT_EQ(Ball(1, Rational(1, 3)).toString(), "[1 +- 0.334]");
+  EXPECT_THROW(Ball::getUnbounded(1).getRadius(), std::domain_error);
+}
+
+TEST(BallTests, plusMinusOperatorsTest) {
+  Ball lhs(2, Rational(1, 100));
+  Ball rhs(Rational(1, 2), Rational(1, 1000));
+  EXPECT_EQ((lhs + rhs).getMidpoint(), Rational(5, 2));
+  EXPECT_EQ((lhs + rhs).getRadius(), Rational(11, 1000));
+  EXPECT_EQ((lhs - rhs).getMidpoint(), Rational(3, 2));
+  EXPECT_EQ((lhs - rhs).getRadius(), Rational(11, 1000));
+  EXPECT_EQ((-lhs).getLower(), Rational(-201, 100));
+  EXPECT_EQ((lhs + Ball::getUnbounded(1)).isBounded(), false);
+}
+
+TEST(BallTests, multiplyOperatorsTest) {
+  Ball lhs(2, Rational(1, 10));
+  Ball rhs(-3, Rational(1, 10));
+  EXPECT_EQ((lhs * rhs).getMidpoint(), -6);
+  EXPECT_EQ((lhs * rhs).getRadius(), Rational(51, 100));
+  EXPECT_EQ((lhs * Ball(3)).getRadius(), Rational(3, 10));
+  EXPECT_EQ((lhs * Ball::getUnbounded(1)).isBounded(), false);
+}
+
+TEST(BallTests, divideOperatorsTest) {
+  Ball lhs(1, Rational(1, 10));
+  Ball val = lhs / Ball(2, Rational(1, 10));
+  EXPECT_EQ(val.getMidpoint(), Rational(1, 2));
+  EXPECT_EQ(val.contains(Rational(11, 19)), true);
+  EXPECT_EQ(val.contains(Rational(9, 21)), true);
+  EXPECT_EQ(val.contains(Rational(6, 10)), false);
+
+  EXPECT_EQ((lhs / Ball(Rational(1, 20), Rational(1, 10))).isBounded(), false);
+  EXPECT_EQ((lhs / Ball(0, Rational(1, 10))).isBounded(), false);
+  EXPECT_THROW(lhs / Ball(0), std::domain_error);
+}
+
+TEST(BallTests, roundTest) {
+  Ball val(Rational(2, 3), Rational(1, 1000));
+  EXPECT_EQ(val.round(2).getMidpoint(), Rational(67, 100));
+  EXPECT_EQ(val.round(2).getRadius(), Rational(6, 1000));
+  EXPECT_EQ(val.round(2).contains(Rational(2, 3)), true);
+  EXPECT_EQ(Ball(Rational(1, 2)).round(2).getRadius(), 0);
+}
+
+TEST(BallTests, functionsTest) {
+  const size_t precision = 20;
+
+  Ball val = functions::sqrt(Ball(2, Rational(1, 1000000)), precision);
+  EXPECT_EQ(val.contains(Rational(1414213562, 1000000000)), true);
+  EXPECT_EQ(val.getRadius() < Rational(1, 1000000), true);
+
+  val = functions::ln(Ball(Rational(1, 10), Rational(1, 20)), precision);
+  EXPECT_EQ(val.contains(Rational(-2995732273, 1000000000)), true);
+  EXPECT_EQ(val.contains(Rational(-2302585093, 1000000000)), true);
+
+  EXPECT_EQ(functions::ln(Ball(Rational(1, 10), Rational(1, 10)), precision).isBounded(), false);
+  EXPECT_EQ(functions::tan(Ball(Rational(15708, 10000), Rational(1, 10)), precision).isBounded(), false);
+  EXPECT_EQ(functions::factorial(Ball(3, Rational(1, 10))).isBounded(), false);
+  EXPECT_EQ(functions::factorial(Ball(3)).getMidpoint(), 6);
+}
+
+TEST(BallTests, evaluationErrorTest) {
+  const size_t precision = 10;
+  const size_t refPrecision = 40;
+
+  Rational maxRadius(1, Integer::pow10(precision));
+  for (const Rational &rhs : {Rational(1, 3), Rational(-7, 3), Rational(355, 226), Rational(-250, 3)}) {
+    Rational absRhs = functions::abs(rhs);
+    EXPECT_EQ(functions::exp(Ball(rhs), precision).contains(functions::exp(rhs, refPrecision)), true);
+    EXPECT_EQ(functions::ln(Ball(absRhs), precision).contains(functions::ln(absRhs, refPrecision)), true);
+    EXPECT_EQ(functions::sin(Ball(rhs), precision).contains(functions::sin(rhs, refPrecision)), true);
+    EXPECT_EQ(functions::cos(Ball(rhs), precision).contains(functions::cos(rhs, refPrecision)), true);
+    EXPECT_EQ(functions::tan(Ball(rhs), precision).contains(functions::tan(rhs, refPrecision)), true);
+    EXPECT_EQ(functions::atan(Ball(rhs), precision).contains(functions::atan(rhs, refPrecision)), true);
+    EXPECT_EQ(functions::pow(Ball(absRhs), Ball(rhs), precision).getRadius() <= maxRadius, true);
+    EXPECT_EQ(functions::tan(Ball(rhs), precision).getRadius() <= maxRadius, true);
+  }
+}
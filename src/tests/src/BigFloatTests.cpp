@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "single_entities/terms/numbers/BigFloat.hpp"
+
+using RoundingMode = BigFloat::RoundingMode;
+
+TEST(BigFloatTests, rationalConstructorTest) {
+  EXPECT_EQ(BigFloat(Rational(2, 3), 3, RoundingMode::HalfUp).toRational(), Rational(667, 1000));
+  EXPECT_EQ(BigFloat(Rational(2, 3), 3, RoundingMode::Down).toRational(), Rational(666, 1000));
+  EXPECT_EQ(BigFloat(Rational(-1, 3), 3, RoundingMode::Up).toRational(), Rational(-334, 1000));
+  EXPECT_EQ(BigFloat(Rational(-1, 8), 2, RoundingMode::HalfUp).toRational(), Rational(-13, 100));
+}
+
+TEST(BigFloatTests, plusMinusOperatorsTest) {
+  BigFloat val(15, -1);
+  EXPECT_EQ((val + 2).toRational(), Rational(7, 2));
+  EXPECT_EQ((BigFloat(2) - val).toRational(), Rational(1, 2));
+  EXPECT_EQ((val - BigFloat(1, 2)).toRational(), Rational(-197, 2));
+  EXPECT_EQ((-val).toRational(), Rational(-3, 2));
+
+  BigFloat longVal(Integer(std::string(60, '7')), -1);
+  EXPECT_EQ((longVal += longVal).toRational(), Rational(Integer("15" + std::string(58, '5') + "4"), 10));
+  EXPECT_EQ((longVal -= longVal).toRational(), 0);
+}
+
+TEST(BigFloatTests, multiplyOperatorsTest) {
+  BigFloat val(15, -1);
+  EXPECT_EQ((val * val).toRational(), Rational(9, 4));
+  EXPECT_EQ((val * -2).toRational(), -3);
+  EXPECT_EQ((val * 0).toRational(), 0);
+}
+
+TEST(BigFloatTests, divideOperatorsTest) {
+  BigFloat val(Rational(2), 5, RoundingMode::HalfUp);
+  EXPECT_EQ((val / 3).toString(), "0.66667");
+  EXPECT_EQ((-val / 3).toString(), "-0.66667");
+  EXPECT_EQ((BigFloat(1) / val).toString(), "0.5");
+  EXPECT_EQ((BigFloat(2, 3) / val).toString(), "1000");
+
+  val.setRoundingMode(RoundingMode::Down);
+  EXPECT_EQ((val / 3).toString(), "0.66666");
+  EXPECT_THROW(val / 0, std::domain_error);
+}
+
+TEST(BigFloatTests, compareOperatorsTest) {
+  BigFloat val(15, -1);
+  EXPECT_EQ(val == BigFloat(150, -2), true);
+  EXPECT_EQ(val != 1, true);
+  EXPECT_EQ(val < 2, true);
+  EXPECT_EQ(val > -2, true);
+  EXPECT_EQ(val <= BigFloat(15, -1), true);
+  EXPECT_EQ(val >= BigFloat(16, -1), false);
+}
+
+TEST(BigFloatTests, roundTest) {
+  BigFloat val(-12345, -4);
+  EXPECT_EQ(val.round(2).toRational(), Rational(-123, 100));
+  EXPECT_EQ(val.round(3).toRational(), Rational(-1235, 1000));
+  EXPECT_EQ(val.round(5).toRational(), val.toRational());
+  EXPECT_EQ(val.round(3).getPrecision(), (size_t)3);
+}
+
+TEST(BigFloatTests, absSqrtTest) {
+  EXPECT_EQ(abs(BigFloat(-15, -1)).toRational(), Rational(3, 2));
+
+  BigFloat val(Rational(2), 10, RoundingMode::HalfUp);
+  EXPECT_EQ(sqrt(val).toString(), "1.4142135624");
+  val.setRoundingMode(RoundingMode::Down);
+  EXPECT_EQ(sqrt(val).toString(), "1.4142135623");
+  EXPECT_EQ(sqrt(BigFloat(Rational(4), 10, RoundingMode::Up)).toString(), "2");
+  EXPECT_THROW(sqrt(BigFloat(-1)), std::domain_error);
+}
@@ -2,8 +2,12 @@
 
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include "calculator/Calculator.hpp"
+#include "single_entities/operators/NamespaceFunctions.hpp"
 
 TEST(CalculatorTests, calculationPositiveTests) {
   std::ifstream testsIn(RESOURCES_DIR "positive_tests.txt");
@@ -32,6 +36,95 @@ TEST(CalculatorTests, getETest) {
             "2.7182818284590452353602874713526624977572470936999595749669676277240766303535475945713821785251664274");
 }
 
+TEST(CalculatorTests, getEHighPrecisionTest) {
+  const int precision = 1000;
+  Calculator calc;
+  calc.setPrecision(precision);
+  EXPECT_EQ(calc.calculate("e").substr(precision - 8), "9570350354");
+}
+
+TEST(CalculatorTests, getPiHighPrecisionTest) {
+  const int precision = 1000;
+  Calculator calc;
+  calc.setPrecision(precision);
+  EXPECT_EQ(calc.calculate("pi").substr(precision - 8), "2164201989");
+}
+
+TEST(CalculatorTests, lnHighPrecisionTest) {
+  const int precision = 1000;
+  Calculator calc;
+  calc.setPrecision(precision);
+  EXPECT_EQ(calc.calculate("ln(3)").substr(precision - 8), "2933973323");
+}
+
+TEST(CalculatorTests, expHighPrecisionTest) {
+  const int precision = 1000;
+  Calculator calc;
+  calc.setPrecision(precision);
+  EXPECT_EQ(calc.calculate("exp(1/3)").substr(precision - 8), "1631625718");
+  EXPECT_EQ(calc.calculate("2^(3/7)").substr(precision - 8), "8676515901");
+}
+
+TEST(CalculatorTests, expBitBurstTest) {
+  const int precision = 1500;
+  Calculator calc;
+  calc.setPrecision(precision);
+  EXPECT_EQ(calc.calculate("exp(1/3)").substr(precision - 8), "1709318407");
+  EXPECT_EQ(calc.calculate("2^(3/7)").substr(precision - 8), "0677919902");
+}
+
+TEST(CalculatorTests, trigonometryHighPrecisionTest) {
+  const int precision = 1000;
+  Calculator calc;
+  calc.setPrecision(precision);
+  EXPECT_EQ(calc.calculate("1+sin(1/3)").substr(precision - 8), "8910619085");
+  EXPECT_EQ(calc.calculate("acos(1/10)").substr(precision - 8), "8298060748");
+}
+
+TEST(CalculatorTests, sinCosBitBurstTest) {
+  const size_t precision = 20001;
+  std::string sinStr = functions::sin(Rational(1, 3), precision).toString(precision);
+  EXPECT_EQ(sinStr.substr(sinStr.size() - 10), "6620104632");
+  std::string cosStr = functions::cos(Rational(1, 3), precision).toString(precision);
+  EXPECT_EQ(cosStr.substr(cosStr.size() - 10), "3274215004");
+}
+
+TEST(CalculatorTests, zeroPrecisionTest) {
+  EXPECT_EQ(functions::tan(1, 0), 2);
+  EXPECT_EQ(functions::cot(1, 0), 1);
+  EXPECT_THROW(functions::tan(Rational(3, 2), 0), std::domain_error);
+  EXPECT_THROW(functions::cot(Rational(1, 3), 0), std::domain_error);
+}
+
+TEST(CalculatorTests, constantsCacheTest) {
+  const Rational pi("3.141592653589793238462643383279502884197169399375105820974944592307816406286208998628034825342"
+                    "1170679821480865132823066470938446096");
+  const std::vector<size_t> precisions = {110, 90, 120, 100};
+
+  std::vector<Rational> results(precisions.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < precisions.size(); i++) {
+    threads.emplace_back([&, i] { results[i] = functions::getPi(precisions[i]); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < precisions.size(); i++) {
+    EXPECT_EQ(results[i], pi.round(precisions[i]));
+  }
+
+  const size_t precision = 80;
+  Rational ln2 = functions::ln(2, precision + 20);
+  EXPECT_EQ(functions::ln(2, precision), ln2.round(precision));
+}
+
+TEST(CalculatorTests, getPiAgmTest) {
+  for (size_t precision : {73, 100, 128, 500}) {
+    EXPECT_EQ(functions::getPiAgm(precision), functions::getPi(precision));
+  }
+}
+
 TEST(CalculatorTests, getSetPrecisionTest) {
   const int precision = 100;
   Calculator calc;
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "single_entities/terms/numbers/FixedInteger.hpp"
+
+using Int128 = FixedInteger<128>;
+
+TEST(FixedIntegerTests, constexprOperatorsTest) {
+  constexpr Int128 val = Int128(INT64_MAX) * Int128(INT64_MAX) - Int128(1) + Int128(-2);
+  static_assert(val > Int128(INT64_MAX), "");
+  static_assert(-val < Int128(0), "");
+  EXPECT_EQ(val.toString(), "85070591730234615847396907784232501246");
+}
+
+TEST(FixedIntegerTests, plusMinusOperatorsTest) {
+  Int128 val(2);
+  EXPECT_EQ(val + 3, 5);
+  EXPECT_EQ(val + -3, -1);
+  EXPECT_EQ(val - 3, -1);
+  EXPECT_EQ(val - -3, 5);
+  EXPECT_EQ(-val - 3, -5);
+  EXPECT_EQ(val - 2, 0);
+}
+
+TEST(FixedIntegerTests, multiplyOperatorsTest) {
+  Int128 val(-3);
+  EXPECT_EQ(val * 3, -9);
+  EXPECT_EQ(val * -3, 9);
+  EXPECT_EQ(val * 0, 0);
+}
+
+TEST(FixedIntegerTests, compareOperatorsTest) {
+  Int128 val(2);
+  EXPECT_EQ(val < 3, true);
+  EXPECT_EQ(val > -3, true);
+  EXPECT_EQ(-val < -1, true);
+  EXPECT_EQ(val <= 2, true);
+  EXPECT_EQ(val >= 3, false);
+  EXPECT_EQ(val != 2, false);
+}
+
+TEST(FixedIntegerTests, overflowTest) {
+  Int128 val(INT64_MAX);
+  val *= INT64_MAX;
+  EXPECT_EQ(val.tryMultiply(5), false);
+  EXPECT_EQ(val.tryAdd(val * 4), false);
+  EXPECT_EQ(val.toString(), "85070591730234615847396907784232501249");
+  EXPECT_THROW(val * 5, std::overflow_error);
+  EXPECT_EQ(val.toInteger() * 5, Integer("425352958651173079236984538921162506245"));
+}
+
+TEST(FixedIntegerTests, integerRationalConversionTest) {
+  EXPECT_EQ(Int128(Integer("-85070591730234615847396907784232501249")).toInteger(),
+            Integer("-85070591730234615847396907784232501249"));
+  EXPECT_EQ(Int128(Integer("340282366920938463463374607431768211455")).toString(),
+            "340282366920938463463374607431768211455");
+  EXPECT_THROW(Int128(Integer("340282366920938463463374607431768211456")), std::overflow_error);
+  EXPECT_EQ(Int128(-5).toRational() / 2, Rational(-5, 2));
+}
+
+TEST(FixedIntegerTests, promotingOperatorsTest) {
+  using PromotingInt128 = PromotingInteger<128>;
+
+  PromotingInt128 val(INT64_MAX);
+  val *= INT64_MAX;
+  EXPECT_EQ(val.isPromoted(), false);
+  EXPECT_EQ(val.toString(), "85070591730234615847396907784232501249");
+
+  PromotingInt128 product = val * INT64_MAX;
+  EXPECT_EQ(product.isPromoted(), true);
+  EXPECT_EQ(product.toInteger(), Integer("784637716923335095224261902710254454442933591094742482943"));
+  EXPECT_EQ(product > val, true);
+  EXPECT_EQ(-product < -val, true);
+
+  PromotingInt128 sum = -val - val * 4;
+  EXPECT_EQ(sum.isPromoted(), true);
+  EXPECT_EQ(sum.toString(), "-425352958651173079236984538921162506245");
+  EXPECT_EQ(sum + val * 5, 0);
+
+  EXPECT_EQ(PromotingInt128(Integer("12345678901234567890")).isPromoted(), false);
+  EXPECT_EQ(PromotingInt128(Integer(std::string(40, '9'))).isPromoted(), true);
+}
+
+TEST(FixedIntegerTests, rationalOperatorsTest) {
+  Int128 val(-3);
+  EXPECT_EQ(val + Rational(1, 2), Rational(-5, 2));
+  EXPECT_EQ(Rational(1, 2) - val, Rational(7, 2));
+  EXPECT_EQ(val * Rational(1, 6), Rational(-1, 2));
+  EXPECT_EQ(Rational(1, 2) / val, Rational(-1, 6));
+  EXPECT_EQ(val < Rational(-5, 2), true);
+  EXPECT_EQ(Rational(-3) == val, true);
+
+  PromotingInteger<128> promotedVal = PromotingInteger<128>(Int128(INT64_MAX) * INT64_MAX) * INT64_MAX;
+  EXPECT_EQ(promotedVal / Rational(INT64_MAX), Int128(INT64_MAX) * INT64_MAX);
+  EXPECT_EQ(Rational(1, 3) >= promotedVal, false);
+}
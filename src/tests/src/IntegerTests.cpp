@@ -36,6 +36,38 @@ TEST(IntegerTests, multiplyOperatorsTest) {
   Integer val(2);
   EXPECT_EQ(val * 2, 4);
   EXPECT_EQ(2 * val, 4);
+
+  Integer longVal(std::string(20000, '9'));
+  EXPECT_EQ((longVal * longVal).toString(), std::string(19999, '9') + "8" + std::string(19999, '0') + "1");
+  EXPECT_EQ((longVal * -longVal).toString(), "-" + std::string(19999, '9') + "8" + std::string(19999, '0') + "1");
+}
+
+TEST(IntegerTests, addMulSubMulTest) {
+  Integer val(10);
+  EXPECT_EQ(addMul(val, Integer(3), Integer(4)), 22);
+  EXPECT_EQ(addMul(val, Integer(-3), Integer(10)), -8);
+  EXPECT_EQ(subMul(val, Integer(-2), Integer(-4)), -16);
+  EXPECT_EQ(subMul(val, Integer(-2), Integer(9)), 2);
+  EXPECT_EQ(addMul(val, Integer(0), Integer(9)), 2);
+  EXPECT_EQ(mulAdd(Integer(-2), Integer(9), val), -16);
+
+  Integer longVal(std::string(1000, '9'));
+  EXPECT_EQ(addMul(val, longVal, longVal), longVal * longVal + 2);
+  EXPECT_EQ(subMul(val, longVal, longVal), 2);
+
+  Integer lhs("12345678901234567890123456789012345678901234567890");
+  Integer rhs("-98765432109876543210987654321");
+  val = lhs;
+  EXPECT_EQ(addMul(val, val, Integer(2)), Integer("37037036703703703670370370367037037036703703703670"));
+  val = lhs;
+  EXPECT_EQ(subMul(val, val, val), Integer("-15241578753238836750495351562566681945008382873374470355759929"
+                                           "8887872412741998489559520973784484210"));
+  val = lhs;
+  EXPECT_EQ(addMul(val, rhs, val), Integer("-12193263113702179522618503273251028807325102880732388355442114"
+                                           "00701209891784800"));
+  val = rhs;
+  EXPECT_EQ(subMul(val, val, lhs), Integer("12193263113702179522618503273374485596337448559632635269011138"
+                                           "69836900138698369"));
 }
 
 TEST(IntegerTests, divideAssignmentOperatorsTest) {
@@ -48,6 +80,36 @@ TEST(IntegerTests, divideOperatorsTest) {
   Integer val(2);
   EXPECT_EQ(val / 2, 1);
   EXPECT_EQ(2 / val, 1);
+
+  Integer lhs("1000000000000000001798465042647412146620280340569649349251249");
+  Integer rhs("12157665459056928812");
+  EXPECT_EQ(lhs / rhs, Integer("82252633399699590886328617128086040338673"));
+  EXPECT_EQ(lhs % rhs, Integer("10156463477617704773"));
+
+  lhs = Integer("123456789012345678901234567890123456789");
+  rhs = Integer("1234500000000000000000000");
+  EXPECT_EQ(lhs / rhs, Integer("100005499402467"));
+  EXPECT_EQ(lhs % rhs, Integer("167401234567890123456789"));
+
+  lhs = Integer("15241578753238836750495351562566681945005334557625361987875019051998750190528");
+  rhs = Integer("987654321987654321000000000000000000000000000");
+  EXPECT_EQ(lhs / rhs, Integer("15432098472029322506753953188110"));
+  EXPECT_EQ(lhs % rhs, Integer("21071626767234315361987875019051998750190528"));
+}
+
+TEST(IntegerTests, divExactTest) {
+  Integer val(-24);
+  EXPECT_EQ(val.divExact(Integer(6)), -4);
+  EXPECT_EQ(val.divExact(Integer(-4)), 1);
+  EXPECT_EQ(Integer(0).divExact(Integer(7)), 0);
+  EXPECT_EQ(Integer("123456789123456789000000000000").divExact(Integer("1000000000000")),
+            Integer("123456789123456789"));
+  EXPECT_EQ(Integer("98765432109876543210987654321098765432100864").divExact(Integer("3072")),
+            Integer("32150205764933770576493377057649337705762"));
+  EXPECT_EQ(Integer("163655207202731220417087067129697457171376585736480533889679360000000000000")
+                .divExact(Integer("165700897274124009727097569280000000000000")),
+            Integer("987654321098765432109876543210987"));
+  EXPECT_THROW(val.divExact(Integer(0)), std::domain_error);
 }
 
 TEST(IntegerTests, moduloAssignmentOperatorsTest) {
@@ -150,6 +212,12 @@ TEST(IntegerTests, outOperatorsTest) {
   std::stringstream out;
   out << val;
   EXPECT_EQ(out.str(), "2");
+
+  std::string longStr = "-1" + std::string(5000, '0') + "123000000000456";
+  std::stringstream longOut;
+  longOut << Integer(longStr);
+  EXPECT_EQ(longOut.str(), longStr);
+  EXPECT_EQ(Integer(longStr).toString(), longStr);
 }
 
 TEST(IntegerTests, divisionModuloNegativeTest) {
@@ -171,3 +239,76 @@ TEST(IntegerTests, getTypenameTest) {
 TEST(IntegerTests, negativeToStringTest) {
   EXPECT_EQ(Integer(-1).toString(), "-1");
 }
+
+TEST(IntegerTests, toInt64Test) {
+  EXPECT_EQ(Integer(INT64_MIN).toString(), "-9223372036854775808");
+  EXPECT_EQ(Integer("-123456789012345678").toInt64(), -123456789012345678);
+  EXPECT_EQ(Integer(0).toInt64(), 0);
+  EXPECT_THROW(Integer(INT64_MAX).toInt64(), std::out_of_range);
+}
+
+TEST(IntegerTests, pow10Test) {
+  EXPECT_EQ(Integer::pow10(0), 1);
+  EXPECT_EQ(Integer::pow10(9).toString(), "1000000000");
+  EXPECT_EQ(Integer::pow10(20).toString(), "100000000000000000000");
+  EXPECT_EQ(Integer::pow10(20), Integer::pow10(20));
+  EXPECT_EQ(Integer::pow10(100000).toString(), "1" + std::string(100000, '0'));
+}
+
+TEST(IntegerTests, sharedCopyTest) {
+  Integer val("123456789012345678901234567890");
+  Integer copy = val;
+  copy += 1;
+  EXPECT_EQ(val.toString(), "123456789012345678901234567890");
+  EXPECT_EQ(copy.toString(), "123456789012345678901234567891");
+
+  copy = val;
+  addMul(copy, val, val);
+  EXPECT_EQ(val.toString(), "123456789012345678901234567890");
+  copy = val;
+  copy %= 1000;
+  EXPECT_EQ(copy, 890);
+  EXPECT_EQ(val.toString(), "123456789012345678901234567890");
+}
+
+TEST(IntegerTests, int64CompareTest) {
+  EXPECT_EQ(Integer(INT64_MIN) == INT64_MIN, true);
+  EXPECT_EQ(Integer(INT64_MAX) > INT64_MAX - 1, true);
+  EXPECT_EQ(Integer("-9223372036854775809") < INT64_MIN, true);
+  EXPECT_EQ(INT64_MAX < Integer("9223372036854775808"), true);
+  EXPECT_EQ(Integer("-1000000000") >= -1000000000, true);
+  EXPECT_EQ(-5 <= Integer(-6), false);
+}
+
+TEST(IntegerTests, newtonDivisionTest) {
+  Integer lhs(std::string(50000, '7'));
+  Integer rhs = Integer(std::string(40000, '3')) + 1;
+  Integer mod = Integer(std::string(30000, '5'));
+  Integer val = lhs * rhs + mod;
+  EXPECT_EQ(val / rhs, lhs);
+  EXPECT_EQ(val % rhs, mod);
+  EXPECT_EQ((val - 1) / Integer::pow10(40000), val / Integer::pow10(40000));
+}
+
+TEST(IntegerTests, newtonSqrtTest) {
+  Integer val = Integer(std::string(500, '9')) + 2;
+  EXPECT_EQ(sqrt(val * val), val);
+  EXPECT_EQ(sqrt(val * val - 1), val - 1);
+  EXPECT_EQ(sqrt(val * val + val * 2), val);
+}
+
+TEST(IntegerTests, spillTest) {
+  const size_t digitsNum = 100000;
+  std::string sqrStr = std::string(digitsNum - 2, '9') + "86" + std::string(digitsNum - 2, '0') + "49";
+
+  Integer::setSpillDirectory(testing::TempDir(), 1 << 16);
+  Integer val = Integer::pow10(digitsNum) - 7;
+  Integer sqrVal = val * val;
+  EXPECT_EQ(sqrVal.toString(), sqrStr);
+
+  Integer::setSpillDirectory("", 0);
+  EXPECT_EQ(sqrVal, (Integer::pow10(digitsNum) - 7) * (Integer::pow10(digitsNum) - 7));
+  EXPECT_EQ(sqrVal / val, val);
+
+  EXPECT_THROW(Integer::setSpillDirectory("/nonexistent", 1), std::invalid_argument);
+}
@@ -29,9 +29,14 @@ TEST(InvalidArgumentTests, expressionTest) {
 TEST(InvalidArgumentTests, integerTest) {
   EXPECT_THROW(Integer(""), std::invalid_argument);
   EXPECT_THROW(Integer("a"), std::invalid_argument);
+  EXPECT_THROW(Integer("-"), std::invalid_argument);
 }
 
 TEST(InvalidArgumentTests, rationalTest) {
   EXPECT_THROW(Rational(""), std::invalid_argument);
   EXPECT_THROW(Rational("a"), std::invalid_argument);
+  EXPECT_THROW(Rational("-"), std::invalid_argument);
+  EXPECT_THROW(Rational(".5"), std::invalid_argument);
+  EXPECT_THROW(Rational("5."), std::invalid_argument);
+  EXPECT_THROW(Rational("1.2.3"), std::invalid_argument);
 }
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+
 #include "single_entities/terms/numbers/Rational.hpp"
 
 TEST(RationalTests, integerAssignmentOperatorsTest) {
@@ -22,6 +24,8 @@ TEST(RationalTests, plusOperatorsTest) {
   EXPECT_EQ(intVal + ratVal, 2);
   EXPECT_EQ(ratVal + 2, 2);
   EXPECT_EQ(2 + ratVal, 2);
+  EXPECT_EQ(Rational(5, 12) + Rational(7, 18), Rational(29, 36));
+  EXPECT_EQ(Rational(5, 12) + Rational(-5, 12), 0);
 }
 
 TEST(RationalTests, minusAssignmentOperatorsTest) {
@@ -54,6 +58,7 @@ TEST(RationalTests, multiplyOperatorsTest) {
   EXPECT_EQ(intVal * ratVal, 4);
   EXPECT_EQ(ratVal * 2, 4);
   EXPECT_EQ(2 * ratVal, 4);
+  EXPECT_EQ(Rational(5, 12) * Rational(18, 35), Rational(3, 14));
 }
 
 TEST(RationalTests, divideAssignmentOperatorsTest) {
@@ -113,6 +118,14 @@ TEST(RationalTests, lessOperatorsTest) {
   EXPECT_EQ(intVal < ratVal, true);
   EXPECT_EQ(ratVal < 2, false);
   EXPECT_EQ(2 < ratVal, false);
+
+  EXPECT_EQ(Rational(-1, 3) < Rational(-1, 4), true);
+  EXPECT_EQ(Rational(1, 3) < Rational(1, 4), false);
+  EXPECT_EQ(Rational(0) < Rational(-1, 4), false);
+  EXPECT_EQ(Rational(-1, 4) < Rational(0), true);
+  EXPECT_EQ(Rational(99, 100) < Rational(100, 99), true);
+  EXPECT_EQ(Rational(Integer("100000000000000000000"), 3) < Rational(Integer("3"), Integer("100000000000000")), false);
+  EXPECT_EQ(Rational(Integer("-100000000000000000000"), 3) < Rational(Integer("3"), Integer("100000000000000")), true);
 }
 
 TEST(RationalTests, moreOperatorsTest) {
@@ -157,6 +170,14 @@ TEST(RationalTests, outOperatorsTest) {
   EXPECT_EQ(out.str(), "2");
 }
 
+TEST(RationalTests, roundTest) {
+  EXPECT_EQ(Rational(2, 3).round(2), Rational(67, 100));
+  EXPECT_EQ(Rational(-1, 8).round(2), Rational(-13, 100));
+  EXPECT_EQ(Rational(-1, 3).round(0), 0);
+  EXPECT_EQ(Rational(-1, 3).round(0).toString(), "0");
+  EXPECT_EQ(Rational(1, 7).round(5).toString(), "0.14286");
+}
+
 TEST(RationalTests, getDenominatorTest) {
   EXPECT_EQ(Rational(1, -2).getDenominator().toString(), "2");
 }
@@ -164,3 +185,80 @@ TEST(RationalTests, getDenominatorTest) {
 TEST(RationalTests, negativeDenominatorTest) {
   EXPECT_EQ(Rational(1, -2).toString(), "-0.5");
 }
+
+TEST(RationalTests, int64OverflowTest) {
+  Rational val(INT64_MAX, 3);
+  EXPECT_EQ((val + val).getInteger(), Integer("6148914691236517204"));
+  EXPECT_EQ(val * val * 9, Integer("85070591730234615847396907784232501249"));
+  EXPECT_EQ(val * val / val, val);
+  EXPECT_EQ(val * 3 - INT64_MAX, 0);
+  EXPECT_EQ(Rational(INT64_MIN, 1), Integer("-9223372036854775808"));
+  EXPECT_EQ(Rational(INT64_MIN, INT64_MIN), 1);
+  EXPECT_EQ(Rational(1, INT64_MAX) < Rational(1, INT64_MAX - 1), true);
+}
+
+TEST(RationalTests, limitDenominatorTest) {
+  Rational val("3.141592653589793");
+  EXPECT_EQ(val.limitDenominator(1000), Rational(355, 113));
+  EXPECT_EQ(val.limitDenominator(10), Rational(22, 7));
+  EXPECT_EQ(val.limitDenominator(1), 3);
+  EXPECT_EQ((-val).limitDenominator(100), Rational(-311, 99));
+  EXPECT_EQ(Rational(7, 2).limitDenominator(1), 3);
+  EXPECT_EQ(Rational(1, 3).limitDenominator(2), Rational(1, 2));
+  EXPECT_EQ(Rational(2, 3).limitDenominator(3), Rational(2, 3));
+  EXPECT_THROW(val.limitDenominator(0), std::domain_error);
+}
+
+TEST(RationalTests, bestApproximationTest) {
+  Rational val("3.141592653589793");
+  EXPECT_EQ(val.bestApproximation(Rational(1, 1000)), Rational(201, 64));
+  EXPECT_EQ(val.bestApproximation(Rational(1, 10000000)), Rational(75948, 24175));
+  EXPECT_EQ((-val).bestApproximation(Rational(1, 1000)), Rational(-201, 64));
+  EXPECT_EQ(Rational(1, 3).bestApproximation(Rational(1, 10)), Rational(1, 3));
+  EXPECT_EQ(Rational(1, 3).bestApproximation(Rational(1, 2)), 0);
+  EXPECT_EQ(val.bestApproximation(0), val);
+  EXPECT_THROW(val.bestApproximation(-1), std::domain_error);
+}
+
+TEST(RationalTests, stringConstructorTest) {
+  EXPECT_EQ(Rational("-12.250"), Rational(-49, 4));
+  EXPECT_EQ(Rational("0.000"), 0);
+  EXPECT_EQ(Rational("-0"), 0);
+  EXPECT_EQ(Rational("007.5"), Rational(15, 2));
+  EXPECT_EQ(Rational("0.0000000000000000000000000064"),
+            Rational(Integer(1), Integer("156250000000000000000000000")));
+  EXPECT_EQ(Rational("123456789012345678901234567890.5"),
+            Rational(Integer("246913578024691357802469135781"), Integer(2)));
+}
+
+TEST(RationalTests, mixedIntegerOperatorsTest) {
+  Rational val(-5, 6);
+  Integer bigVal("100000000000000000000");
+  EXPECT_EQ(val + bigVal, Rational(Integer("599999999999999999995"), 6));
+  EXPECT_EQ(bigVal - val, Rational(Integer("600000000000000000005"), 6));
+  EXPECT_EQ(val * bigVal, Rational(Integer("-250000000000000000000"), 3));
+  EXPECT_EQ(val / bigVal, Rational(Integer(-1), Integer("120000000000000000000")));
+  EXPECT_EQ(bigVal / val, Rational(Integer("-120000000000000000000")));
+  EXPECT_EQ(val * INT64_MIN, Rational(Integer("23058430092136939520"), 3));
+  EXPECT_EQ(val - val.getInteger(), val);
+  EXPECT_EQ(-(val + Rational(5, 6)) == 0, true);
+  EXPECT_EQ(Rational(bigVal) == bigVal, true);
+  EXPECT_EQ(Rational(bigVal) / 10 == bigVal, false);
+  EXPECT_THROW(val / Integer(0), std::domain_error);
+  EXPECT_THROW(1 / Rational(0), std::domain_error);
+}
+
+TEST(RationalTests, copyMoveTest) {
+  Rational big(Integer("100000000000000000000"), 3);
+  Rational val = big;
+  val += 1;
+  EXPECT_EQ(big, Rational(Integer("100000000000000000000"), 3));
+  EXPECT_EQ(val, Rational(Integer("100000000000000000003"), 3));
+
+  val = Rational(1, 2);
+  EXPECT_EQ(val, Rational(1, 2));
+  val = big;
+  EXPECT_EQ(val, big);
+  Rational moved = std::move(val);
+  EXPECT_EQ(moved, big);
+}